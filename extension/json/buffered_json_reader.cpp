@@ -202,7 +202,8 @@ void BufferedJSONReader::OpenJSONFile() {
 	lock_guard<mutex> guard(lock);
 	if (!IsOpen()) {
 		auto &fs = FileSystem::GetFileSystem(context);
-		auto regular_file_handle = fs.OpenFile(file_name, FileFlags::FILE_FLAGS_READ | options.compression);
+		auto regular_file_handle = fs.OpenFile(
+		    file_name, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_PARALLEL_DECOMPRESSION | options.compression);
 		file_handle = make_uniq<JSONFileHandle>(std::move(regular_file_handle), BufferAllocator::Get(context));
 	}
 	Reset();
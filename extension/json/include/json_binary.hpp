@@ -0,0 +1,198 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// json_binary.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/optimizer_extension.hpp"
+#include "json_common.hpp"
+
+namespace duckdb {
+
+//! The type tags of the values in a JSONB document
+enum class JSONBinaryTag : uint8_t {
+	JSON_NULL = 0,
+	JSON_FALSE = 1,
+	JSON_TRUE = 2,
+	UINT = 3,
+	SINT = 4,
+	REAL = 5,
+	STRING = 6,
+	ARRAY = 7,
+	OBJECT = 8
+};
+
+//! JSONB is a pre-parsed, binary representation of JSON that is stored as a BLOB, so that reading it does not require
+//! re-tokenizing the text. Every value starts with a one-byte tag, followed by (all integers are little-endian):
+//!  - numbers: the 8-byte uint64/int64/double
+//!  - strings: the 4-byte length and the unescaped bytes
+//!  - arrays: the 4-byte size of the array (in bytes) and element count, the 4-byte offset of every element, and the
+//!    elements
+//!  - objects: the 4-byte size of the object (in bytes) and member count, the 4-byte offsets of the key and value of
+//!    every member (in the original order), the member indexes sorted by key, and the keys (4-byte length and bytes)
+//!    and values
+//! The offsets are relative to the start of the container, so every value within a document is a JSONB document too.
+//! Looking up a path takes a binary search per object field and a single offset lookup per array index.
+struct JSONBinary {
+public:
+	static constexpr const char *TYPE_NAME = "JSONB";
+	//! The size of the tag, size and count of a container
+	static constexpr idx_t CONTAINER_HEADER_SIZE = 9;
+
+	static LogicalType GetType();
+
+public:
+	//===--------------------------------------------------------------------===//
+	// Reading values
+	//===--------------------------------------------------------------------===//
+	static inline JSONBinaryTag GetTag(const_data_ptr_t val) {
+		return static_cast<JSONBinaryTag>(*val);
+	}
+	static inline bool IsNull(const_data_ptr_t val) {
+		return GetTag(val) == JSONBinaryTag::JSON_NULL;
+	}
+	static inline uint32_t ReadUInt32(const_data_ptr_t ptr) {
+		return Load<uint32_t>(ptr);
+	}
+	//! The size of a value (in bytes)
+	static idx_t GetSize(const_data_ptr_t val);
+	//! The element/member count of an array/object
+	static inline uint32_t GetCount(const_data_ptr_t val) {
+		D_ASSERT(GetTag(val) == JSONBinaryTag::ARRAY || GetTag(val) == JSONBinaryTag::OBJECT);
+		return ReadUInt32(val + 5);
+	}
+	static inline const char *GetString(const_data_ptr_t val, uint32_t &len) {
+		D_ASSERT(GetTag(val) == JSONBinaryTag::STRING);
+		len = ReadUInt32(val + 1);
+		return const_char_ptr_cast(val + 5);
+	}
+	static inline const_data_ptr_t GetArrayElement(const_data_ptr_t val, idx_t idx) {
+		D_ASSERT(GetTag(val) == JSONBinaryTag::ARRAY && idx < GetCount(val));
+		return val + ReadUInt32(val + CONTAINER_HEADER_SIZE + idx * sizeof(uint32_t));
+	}
+	static inline const char *GetObjectKey(const_data_ptr_t val, idx_t idx, uint32_t &len) {
+		D_ASSERT(GetTag(val) == JSONBinaryTag::OBJECT && idx < GetCount(val));
+		auto key = val + ReadUInt32(val + CONTAINER_HEADER_SIZE + idx * 2 * sizeof(uint32_t));
+		len = ReadUInt32(key);
+		return const_char_ptr_cast(key + sizeof(uint32_t));
+	}
+	static inline const_data_ptr_t GetObjectValue(const_data_ptr_t val, idx_t idx) {
+		D_ASSERT(GetTag(val) == JSONBinaryTag::OBJECT && idx < GetCount(val));
+		return val + ReadUInt32(val + CONTAINER_HEADER_SIZE + (idx * 2 + 1) * sizeof(uint32_t));
+	}
+	//! Returns the value of the first member of an object with the given key, or nullptr
+	static const_data_ptr_t GetObjectMember(const_data_ptr_t val, const char *key, idx_t key_len);
+	//! Returns the value of an array element, or nullptr
+	static inline const_data_ptr_t GetArrayElementOrNull(const_data_ptr_t val, idx_t idx) {
+		return idx < GetCount(val) ? GetArrayElement(val, idx) : nullptr;
+	}
+
+	static const char *ValTypeToString(const_data_ptr_t val);
+	static inline string_t ValTypeToStringT(const_data_ptr_t val) {
+		return string_t(ValTypeToString(val));
+	}
+
+	//! Checks whether a BLOB is a valid JSONB document
+	static bool IsValid(const_data_ptr_t data, idx_t size);
+
+public:
+	//===--------------------------------------------------------------------===//
+	// JSON pointer / path
+	//===--------------------------------------------------------------------===//
+	//! Get JSONB value using JSON path query (safe, checks the path query)
+	static const_data_ptr_t Get(const_data_ptr_t val, const string_t &path_str);
+	//! Get JSONB value using JSON path query (unsafe)
+	static inline const_data_ptr_t GetUnsafe(const_data_ptr_t val, const char *ptr, const idx_t &len) {
+		if (len == 0) {
+			return nullptr;
+		}
+		switch (*ptr) {
+		case '/':
+			return GetPointer(val, ptr, len);
+		case '$':
+			return GetPath(val, ptr, len);
+		default:
+			throw InternalException("JSON pointer/path does not start with '/' or '$'");
+		}
+	}
+	//! Get JSONB values using JSON path query with wildcards (unsafe)
+	static void GetWildcardPath(const_data_ptr_t val, const char *ptr, const idx_t &len,
+	                            vector<const_data_ptr_t> &vals);
+
+private:
+	//! Get JSONB value using JSON pointer (/field/index/... syntax)
+	static const_data_ptr_t GetPointer(const_data_ptr_t val, const char *ptr, const idx_t &len);
+	//! Get JSONB value using JSON path ($.field[index]... syntax)
+	static const_data_ptr_t GetPath(const_data_ptr_t val, const char *ptr, const idx_t &len);
+
+public:
+	//===--------------------------------------------------------------------===//
+	// Converting from/to text
+	//===--------------------------------------------------------------------===//
+	//! Converts a JSONB value to a yyjson_mut_val (strings are not copied)
+	static yyjson_mut_val *ToMutVal(const_data_ptr_t val, yyjson_mut_doc *doc);
+	//! Converts a JSONB value to JSON text
+	static string_t ToText(const_data_ptr_t val, yyjson_alc *alc);
+};
+
+//! The JSONBinaryWriter converts parsed JSON documents to JSONB, its buffer is reused for every document
+class JSONBinaryWriter {
+public:
+	//! The maximum size of a value in JSONB, excluding the bytes of its string: a container header, or a number, and
+	//! the offsets of an object member
+	static constexpr idx_t MAX_VALUE_SIZE = JSONBinary::CONTAINER_HEADER_SIZE + 3 * sizeof(uint32_t);
+	//! Objects with up to this many members are sorted with an insertion sort
+	static constexpr idx_t INSERTION_SORT_THRESHOLD = 16;
+
+	string_t Write(yyjson_doc *doc, Vector &result);
+
+private:
+	void WriteVal(yyjson_val *val);
+	template <class T>
+	void StoreAt(T value, idx_t pos) {
+		Store<T>(value, buffer.get() + pos);
+	}
+	template <class T>
+	void Append(T value) {
+		StoreAt<T>(value, size);
+		size += sizeof(T);
+	}
+	void AppendString(const char *ptr, idx_t len) {
+		Append<uint32_t>(UnsafeNumericCast<uint32_t>(len));
+		memcpy(buffer.get() + size, ptr, len);
+		size += len;
+	}
+
+private:
+	struct SortKey {
+		uint64_t prefix;
+		const char *ptr;
+		size_t len;
+		uint32_t idx;
+	};
+	static bool SortKeyLessThan(const SortKey &lhs, const SortKey &rhs);
+
+	//! The buffer is sized for the whole document up front, so the values are written without bounds checks
+	unsafe_unique_array<data_t> buffer;
+	idx_t capacity = 0;
+	idx_t size = 0;
+	vector<SortKey> sort_buffer;
+};
+
+//! The JSONBinaryOptimizer rewrites multiple extractions from the same JSON column within a projection or aggregate,
+//! e.g., SELECT j->>'a', j->>'b', j->>'c' FROM t, to extract from the column converted to JSONB. Common subexpression
+//! elimination then converts the column once, so every document is parsed once instead of once per extraction.
+class JSONBinaryOptimizer {
+public:
+	//! The minimum number of distinct extractions from a column for which it is converted
+	static constexpr idx_t MIN_DISTINCT_EXTRACTIONS = 3;
+
+	static OptimizerExtension GetOptimizerExtension();
+	static void Optimize(ClientContext &context, OptimizerExtensionInfo *info, unique_ptr<LogicalOperator> &plan);
+};
+
+} // namespace duckdb
@@ -282,6 +282,10 @@ public:
 
 	//! Validate JSON Path ($.field[index]... syntax), returns true if there are wildcards in the path
 	static JSONPathType ValidatePath(const char *ptr, const idx_t &len, const bool binder);
+	//! Read the key of a JSON Path object field, key_len is set to DConstants::INVALID_INDEX for a wildcard
+	static bool ReadKey(const char *&ptr, const char *const end, const char *&key_ptr, idx_t &key_len);
+	//! Read the index of a JSON Path array index, array_index is set to DConstants::INVALID_INDEX for a wildcard
+	static bool ReadArrayIndex(const char *&ptr, const char *const end, idx_t &array_index, bool &from_back);
 
 private:
 	//! Get JSON pointer (/field/index/... syntax)
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/execution/expression_executor.hpp"
+#include "json_binary.hpp"
 #include "json_functions.hpp"
 
 namespace duckdb {
@@ -167,4 +168,153 @@ public:
 	}
 };
 
+//! The JSONBinaryExecutors are the JSONExecutors for JSONB input, which is read without parsing
+struct JSONBinaryExecutors {
+public:
+	//! Single-argument JSONB read function, i.e. json_type('[1, 2, 3]'::JSONB)
+	template <class T>
+	static void UnaryExecute(DataChunk &args, ExpressionState &state, Vector &result,
+	                         std::function<T(const_data_ptr_t, yyjson_alc *, Vector &)> fun) {
+		auto &lstate = JSONFunctionLocalState::ResetAndGet(state);
+		auto alc = lstate.json_allocator.GetYYAlc();
+
+		auto &inputs = args.data[0];
+		UnaryExecutor::Execute<string_t, T>(inputs, result, args.size(), [&](string_t input) {
+			return fun(const_data_ptr_cast(input.GetData()), alc, result);
+		});
+	}
+
+	//! Two-argument JSONB read function (with path query), i.e. json_type('[1, 2, 3]'::JSONB, '$[0]')
+	template <class T>
+	static void BinaryExecute(DataChunk &args, ExpressionState &state, Vector &result,
+	                          std::function<T(const_data_ptr_t, yyjson_alc *, Vector &)> fun) {
+		auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+		const auto &info = func_expr.bind_info->Cast<JSONReadFunctionData>();
+		auto &lstate = JSONFunctionLocalState::ResetAndGet(state);
+		auto alc = lstate.json_allocator.GetYYAlc();
+
+		auto &inputs = args.data[0];
+		if (info.constant) { // Constant path
+			const char *ptr = info.ptr;
+			const idx_t &len = info.len;
+			if (info.path_type == JSONCommon::JSONPathType::REGULAR) {
+				UnaryExecutor::ExecuteWithNulls<string_t, T>(
+				    inputs, result, args.size(), [&](string_t input, ValidityMask &mask, idx_t idx) {
+					    auto val = JSONBinary::GetUnsafe(const_data_ptr_cast(input.GetData()), ptr, len);
+					    if (!val || JSONBinary::IsNull(val)) {
+						    mask.SetInvalid(idx);
+						    return T {};
+					    } else {
+						    return fun(val, alc, result);
+					    }
+				    });
+			} else {
+				D_ASSERT(info.path_type == JSONCommon::JSONPathType::WILDCARD);
+				vector<const_data_ptr_t> vals;
+				UnaryExecutor::Execute<string_t, list_entry_t>(inputs, result, args.size(), [&](string_t input) {
+					vals.clear();
+					JSONBinary::GetWildcardPath(const_data_ptr_cast(input.GetData()), ptr, len, vals);
+
+					auto current_size = ListVector::GetListSize(result);
+					auto new_size = current_size + vals.size();
+					if (ListVector::GetListCapacity(result) < new_size) {
+						ListVector::Reserve(result, new_size);
+					}
+
+					auto &child_entry = ListVector::GetEntry(result);
+					auto child_vals = FlatVector::GetData<T>(child_entry);
+					auto &child_validity = FlatVector::Validity(child_entry);
+					for (idx_t i = 0; i < vals.size(); i++) {
+						auto &val = vals[i];
+						D_ASSERT(val != nullptr); // Wildcard extract shouldn't give back nullptrs
+						if (JSONBinary::IsNull(val)) {
+							child_validity.SetInvalid(current_size + i);
+						} else {
+							child_vals[current_size + i] = fun(val, alc, child_entry);
+						}
+					}
+
+					ListVector::SetListSize(result, new_size);
+
+					return list_entry_t {current_size, vals.size()};
+				});
+			}
+		} else { // Columnref path
+			D_ASSERT(info.path_type == JSONCommon::JSONPathType::REGULAR);
+			auto &paths = args.data[1];
+			BinaryExecutor::ExecuteWithNulls<string_t, string_t, T>(
+			    inputs, paths, result, args.size(), [&](string_t input, string_t path, ValidityMask &mask, idx_t idx) {
+				    auto val = JSONBinary::Get(const_data_ptr_cast(input.GetData()), path);
+				    if (!val || JSONBinary::IsNull(val)) {
+					    mask.SetInvalid(idx);
+					    return T {};
+				    } else {
+					    return fun(val, alc, result);
+				    }
+			    });
+		}
+		if (args.AllConstant()) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+		}
+	}
+
+	//! JSONB read function with list of path queries, i.e. json_type('[1, 2, 3]'::JSONB, ['$[0]', '$[1]'])
+	template <class T>
+	static void ExecuteMany(DataChunk &args, ExpressionState &state, Vector &result,
+	                        std::function<T(const_data_ptr_t, yyjson_alc *, Vector &)> fun) {
+		auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+		const auto &info = func_expr.bind_info->Cast<JSONReadManyFunctionData>();
+		auto &lstate = JSONFunctionLocalState::ResetAndGet(state);
+		auto alc = lstate.json_allocator.GetYYAlc();
+		D_ASSERT(info.ptrs.size() == info.lens.size());
+
+		const auto count = args.size();
+		const idx_t num_paths = info.ptrs.size();
+		const idx_t list_size = count * num_paths;
+
+		UnifiedVectorFormat input_data;
+		auto &input_vector = args.data[0];
+		input_vector.ToUnifiedFormat(count, input_data);
+		auto inputs = UnifiedVectorFormat::GetData<string_t>(input_data);
+
+		ListVector::Reserve(result, list_size);
+		auto list_entries = FlatVector::GetData<list_entry_t>(result);
+		auto &list_validity = FlatVector::Validity(result);
+
+		auto &child = ListVector::GetEntry(result);
+		auto child_data = FlatVector::GetData<T>(child);
+		auto &child_validity = FlatVector::Validity(child);
+
+		idx_t offset = 0;
+		const_data_ptr_t val;
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = input_data.sel->get_index(i);
+			if (!input_data.validity.RowIsValid(idx)) {
+				list_validity.SetInvalid(i);
+				continue;
+			}
+
+			auto doc = const_data_ptr_cast(inputs[idx].GetData());
+			for (idx_t path_i = 0; path_i < num_paths; path_i++) {
+				auto child_idx = offset + path_i;
+				val = JSONBinary::GetUnsafe(doc, info.ptrs[path_i], info.lens[path_i]);
+				if (!val || JSONBinary::IsNull(val)) {
+					child_validity.SetInvalid(child_idx);
+				} else {
+					child_data[child_idx] = fun(val, alc, child);
+				}
+			}
+
+			list_entries[i].offset = offset;
+			list_entries[i].length = num_paths;
+			offset += num_paths;
+		}
+		ListVector::SetListSize(result, offset);
+
+		if (args.AllConstant()) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+		}
+	}
+};
+
 } // namespace duckdb
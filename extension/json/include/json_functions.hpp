@@ -77,6 +77,7 @@ public:
 	static void RegisterSimpleCastFunctions(CastFunctionSet &casts);
 	static void RegisterJSONCreateCastFunctions(CastFunctionSet &casts);
 	static void RegisterJSONTransformCastFunctions(CastFunctionSet &casts);
+	static void RegisterJSONBinaryCastFunctions(CastFunctionSet &casts);
 
 private:
 	// Scalar functions
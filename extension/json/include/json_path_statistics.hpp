@@ -0,0 +1,89 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// json_path_statistics.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/optimizer/optimizer_extension.hpp"
+#include "duckdb/storage/statistics/json_path_statistics.hpp"
+#include "json_common.hpp"
+
+namespace duckdb {
+
+//! The JSONPathStatisticsCollector computes the JSONPathStatistics of a JSON column at checkpoint. It walks the objects
+//! of every row, and keeps track of the type and the min/max of the scalar values at every path. Paths whose values
+//! all have the same type (integers and reals become DOUBLE) are candidates, the most frequent ones are kept.
+class JSONPathStatisticsCollector : public JSONPathStatisticsAnalyzer {
+public:
+	//! The maximum depth of the paths that are tracked
+	static constexpr idx_t MAX_DEPTH = 4;
+	//! The maximum number of distinct paths that are tracked per row group
+	static constexpr idx_t MAX_TRACKED_PATHS = 256;
+	//! The maximum number of paths that statistics are kept for per row group
+	static constexpr idx_t MAX_PATH_STATISTICS = 32;
+
+public:
+	JSONPathStatisticsCollector();
+
+	bool Analyze(Vector &input, idx_t count) override;
+	vector<JSONPathStatistics> Finalize() override;
+
+	static unique_ptr<JSONPathStatisticsAnalyzer> Create();
+
+private:
+	//! The type of the values at a path
+	enum class JSONPathValueType : uint8_t { NONE, NUMERIC, VARCHAR, INVALID };
+
+	struct JSONPathEntry {
+		explicit JSONPathEntry(vector<string> path);
+
+		//! Returns the statistics of the values at the path
+		BaseStatistics GetStatistics() const;
+
+		vector<string> path;
+		JSONPathValueType type;
+		//! The number of (non-NULL) scalar values at the path
+		idx_t count;
+		//! Whether there were integers/reals at the path, and their min/max
+		bool has_integer;
+		bool has_real;
+		int64_t integer_min;
+		int64_t integer_max;
+		double real_min;
+		double real_max;
+		//! The statistics of the strings at the path
+		BaseStatistics string_stats;
+	};
+
+	void AnalyzeObject(yyjson_val *obj, idx_t depth);
+	optional_ptr<JSONPathEntry> GetEntry(idx_t depth);
+	void AnalyzeValue(JSONPathEntry &entry, yyjson_val *val);
+	bool IsArrayDescendant(const vector<string> &path) const;
+
+private:
+	JSONAllocator json_allocator;
+	//! The path of the current value, and the keys that it consists of
+	string path_buffer;
+	vector<string> path_keys;
+	//! The tracked paths
+	unordered_map<string, idx_t> entry_map;
+	vector<JSONPathEntry> entries;
+	//! The paths that had an array value, the values of the paths below them can be extracted by array index as well
+	unordered_set<string> array_paths;
+	vector<vector<string>> array_path_keys;
+};
+
+//! The JSONPathFilterOptimizer pushes JSONPathFilters into table scans for comparisons of values extracted from a JSON
+//! column with a constant, e.g., WHERE (j->>'$.user.id')::INT > 42, so row groups can be skipped with their
+//! JSONPathStatistics. The comparisons stay in the plan, as the scan does not evaluate the filter.
+class JSONPathFilterOptimizer {
+public:
+	static OptimizerExtension GetOptimizerExtension();
+	static void Optimize(ClientContext &context, OptimizerExtensionInfo *info, unique_ptr<LogicalOperator> &plan);
+};
+
+} // namespace duckdb
@@ -177,6 +177,9 @@ public:
 	//! Column names that we're actually reading (after projection pushdown)
 	vector<string> names;
 	vector<column_t> column_indices;
+	//! Whether records only have to be parsed partially, i.e., only the members whose key is in names
+	bool project_records;
+	json_key_set_t projected_keys;
 
 	//! Buffer manager allocator
 	Allocator &allocator;
@@ -242,6 +245,7 @@ private:
 	void ParseNextChunk(JSONScanGlobalState &gstate);
 
 	void ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining);
+	bool ParseProjectedJSON(char *const json_start, const idx_t json_size, const idx_t remaining);
 	void ThrowObjectSizeError(const idx_t object_size);
 
 	//! Must hold the lock
@@ -253,6 +257,8 @@ private:
 	const JSONScanData &bind_data;
 	//! Thread-local allocator
 	JSONAllocator allocator;
+	//! The keys of the members that are parsed if records are projected
+	optional_ptr<const json_key_set_t> projected_keys;
 
 	//! Current reader and buffer handle
 	optional_ptr<BufferedJSONReader> current_reader;
@@ -0,0 +1,206 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// json_structural_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/bit_utils.hpp"
+#include "duckdb/common/helper.hpp"
+#include "duckdb/common/typedefs.hpp"
+#include "duckdb/common/types.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DUCKDB_JSON_STRUCTURAL_INDEX_SSE2
+#endif
+
+namespace duckdb {
+
+//! The JSONStructuralIndex finds the structural characters of a JSON buffer, i.e., the braces, brackets, commas and
+//! colons that are not inside of a string. It classifies blocks of 64 bytes at once into bitmasks of quotes,
+//! backslashes and structural characters, and then removes the characters that are inside of strings from the
+//! structural characters using a prefix XOR over the unescaped quotes. This allows skipping over JSON values without
+//! looking at each of their bytes.
+class JSONStructuralIndex {
+public:
+	static constexpr idx_t BLOCK_SIZE = 64;
+
+	JSONStructuralIndex(const char *buffer_p, idx_t buffer_size_p) : buffer(buffer_p), buffer_size(buffer_size_p) {
+	}
+
+	//! Starts looking for structural characters at pos, which must not be inside of a string
+	void Reset(idx_t pos) {
+		in_string = false;
+		escaped = false;
+		IndexBlock(pos);
+	}
+
+	//! Returns the position of the next structural character in [current, end), or end
+	idx_t Next(idx_t end) {
+		return Next<false>(end);
+	}
+	//! Returns the position of the next brace or bracket in [current, end), or end
+	idx_t NextBracket(idx_t end) {
+		return Next<true>(end);
+	}
+
+	//! Returns the position after the object or array that starts at pos, or end if it does not end before
+	idx_t SkipContainer(idx_t pos, idx_t end) {
+		D_ASSERT(buffer[pos] == '{' || buffer[pos] == '[');
+		Reset(pos);
+		idx_t parents = 0;
+		for (pos = NextBracket(end); pos != end; pos = NextBracket(end)) {
+			switch (buffer[pos]) {
+			case '{':
+			case '[':
+				parents++;
+				break;
+			case '}':
+			case ']':
+				if (--parents == 0) {
+					return pos + 1;
+				}
+				break;
+			}
+		}
+		return end;
+	}
+
+	//! Returns the position after the closing quote of the string that starts at pos, or end if it does not end before
+	static idx_t SkipString(const char *buffer, idx_t pos, idx_t end) {
+		D_ASSERT(buffer[pos] == '"');
+		for (pos++; pos < end; pos++) {
+			if (buffer[pos] == '"') {
+				return pos + 1;
+			} else if (buffer[pos] == '\\') {
+				pos++; // Skip the escaped char
+			}
+		}
+		return end;
+	}
+
+private:
+	template <bool BRACKETS_ONLY>
+	idx_t Next(idx_t end) {
+		while (block_start < end) {
+			const auto mask = BRACKETS_ONLY ? bracket_mask : structural_mask;
+			if (mask) {
+				const auto offset = static_cast<idx_t>(CountZeros<uint64_t>::Trailing(mask));
+				const auto pos = block_start + offset;
+				if (pos >= end) {
+					break;
+				}
+				// Remove the character and the ones before it, which have been skipped
+				const auto remaining = offset == BLOCK_SIZE - 1 ? 0 : ~uint64_t(0) << (offset + 1);
+				structural_mask &= remaining;
+				bracket_mask &= remaining;
+				return pos;
+			}
+			IndexBlock(block_start + BLOCK_SIZE);
+		}
+		return end;
+	}
+
+	void IndexBlock(idx_t pos) {
+		block_start = pos;
+		const char *block = buffer + pos;
+		char padded[BLOCK_SIZE];
+		if (pos + BLOCK_SIZE > buffer_size) {
+			// the remainder of the buffer is smaller than a block: pad it with whitespace
+			const auto remaining = pos < buffer_size ? buffer_size - pos : 0;
+			memset(padded, ' ', BLOCK_SIZE);
+			memcpy(padded, block, remaining);
+			block = padded;
+		}
+
+		uint64_t quote_mask = 0;
+		uint64_t backslash_mask = 0;
+		uint64_t separator_mask = 0;
+		bracket_mask = 0;
+#ifdef DUCKDB_JSON_STRUCTURAL_INDEX_SSE2
+		const auto quote = _mm_set1_epi8('"');
+		const auto backslash = _mm_set1_epi8('\\');
+		const auto comma = _mm_set1_epi8(',');
+		const auto colon = _mm_set1_epi8(':');
+		// '[' (0x5B) and '{' (0x7B) as well as ']' (0x5D) and '}' (0x7D) only differ in bit 0x20
+		const auto lower_case = _mm_set1_epi8(0x20);
+		const auto open_brace = _mm_set1_epi8('{');
+		const auto close_brace = _mm_set1_epi8('}');
+		for (idx_t i = 0; i < BLOCK_SIZE; i += 16) {
+			auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + i));
+			auto lower = _mm_or_si128(chars, lower_case);
+			auto brackets = _mm_or_si128(_mm_cmpeq_epi8(lower, open_brace), _mm_cmpeq_epi8(lower, close_brace));
+			auto separators = _mm_or_si128(_mm_cmpeq_epi8(chars, comma), _mm_cmpeq_epi8(chars, colon));
+			auto quotes = _mm_cmpeq_epi8(chars, quote);
+			auto backslashes = _mm_cmpeq_epi8(chars, backslash);
+			bracket_mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(brackets))) << i;
+			separator_mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(separators))) << i;
+			quote_mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(quotes))) << i;
+			backslash_mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(backslashes))) << i;
+		}
+#else
+		for (idx_t i = 0; i < BLOCK_SIZE; i++) {
+			const auto c = block[i];
+			const auto lower = c | 0x20;
+			bracket_mask |= static_cast<uint64_t>(lower == '{' || lower == '}') << i;
+			separator_mask |= static_cast<uint64_t>(c == ',' || c == ':') << i;
+			quote_mask |= static_cast<uint64_t>(c == '"') << i;
+			backslash_mask |= static_cast<uint64_t>(c == '\\') << i;
+		}
+#endif
+		if (backslash_mask || escaped) {
+			quote_mask &= ~EscapedMask(backslash_mask);
+		}
+
+		// The prefix XOR of the quotes sets the bits from an opening quote up to (excluding) its closing quote
+		auto string_mask = quote_mask;
+		string_mask ^= string_mask << 1;
+		string_mask ^= string_mask << 2;
+		string_mask ^= string_mask << 4;
+		string_mask ^= string_mask << 8;
+		string_mask ^= string_mask << 16;
+		string_mask ^= string_mask << 32;
+		if (in_string) {
+			string_mask = ~string_mask;
+		}
+		in_string = (string_mask >> 63) != 0;
+		bracket_mask &= ~string_mask;
+		structural_mask = bracket_mask | (separator_mask & ~string_mask);
+	}
+
+	//! Returns the mask of the characters that are escaped by a backslash, and carries over into the next block
+	uint64_t EscapedMask(uint64_t backslash_mask) {
+		uint64_t escaped_mask = escaped ? 1 : 0;
+		escaped = false;
+		backslash_mask &= ~escaped_mask;
+		while (backslash_mask) {
+			const auto i = static_cast<idx_t>(CountZeros<uint64_t>::Trailing(backslash_mask));
+			if (i == BLOCK_SIZE - 1) {
+				escaped = true;
+				break;
+			}
+			// The backslash escapes the next character, which can therefore not escape a character itself
+			escaped_mask |= uint64_t(1) << (i + 1);
+			backslash_mask &= ~(uint64_t(3) << i);
+		}
+		return escaped_mask;
+	}
+
+private:
+	const char *buffer;
+	idx_t buffer_size;
+	//! The start of the indexed block
+	idx_t block_start = 0;
+	//! The structural characters, and only the braces and brackets, of the block that have not been skipped yet
+	uint64_t structural_mask = 0;
+	uint64_t bracket_mask = 0;
+	//! Whether the indexed block ends inside of a string, and whether the first character of the next one is escaped
+	bool in_string = false;
+	bool escaped = false;
+};
+
+} // namespace duckdb
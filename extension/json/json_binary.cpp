@@ -0,0 +1,875 @@
+#include "json_binary.hpp"
+
+#include "duckdb/common/bswap.hpp"
+#include "duckdb/function/cast/cast_function_set.hpp"
+#include "duckdb/function/cast/default_casts.hpp"
+#include "duckdb/function/function_binder.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/parser/expression_map.hpp"
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "json_functions.hpp"
+
+namespace duckdb {
+
+LogicalType JSONBinary::GetType() {
+	auto jsonb_type = LogicalType(LogicalTypeId::BLOB);
+	jsonb_type.SetAlias(TYPE_NAME);
+	return jsonb_type;
+}
+
+//===--------------------------------------------------------------------===//
+// Reading values
+//===--------------------------------------------------------------------===//
+idx_t JSONBinary::GetSize(const_data_ptr_t val) {
+	switch (GetTag(val)) {
+	case JSONBinaryTag::JSON_NULL:
+	case JSONBinaryTag::JSON_FALSE:
+	case JSONBinaryTag::JSON_TRUE:
+		return 1;
+	case JSONBinaryTag::UINT:
+	case JSONBinaryTag::SINT:
+	case JSONBinaryTag::REAL:
+		return 1 + sizeof(uint64_t);
+	case JSONBinaryTag::STRING:
+		return 1 + sizeof(uint32_t) + ReadUInt32(val + 1);
+	case JSONBinaryTag::ARRAY:
+	case JSONBinaryTag::OBJECT:
+		return ReadUInt32(val + 1);
+	default:
+		throw InternalException("Unexpected tag in JSONBinary::GetSize");
+	}
+}
+
+static inline int CompareKeys(const char *l_ptr, idx_t l_len, const char *r_ptr, idx_t r_len) {
+	const auto cmp = memcmp(l_ptr, r_ptr, MinValue(l_len, r_len));
+	if (cmp != 0) {
+		return cmp;
+	}
+	return l_len < r_len ? -1 : (l_len == r_len ? 0 : 1);
+}
+
+const_data_ptr_t JSONBinary::GetObjectMember(const_data_ptr_t val, const char *key, idx_t key_len) {
+	const auto count = GetCount(val);
+	const auto sorted = val + CONTAINER_HEADER_SIZE + count * 2 * sizeof(uint32_t);
+	// Binary search for the first member with the key, members with the same key are sorted by their index
+	idx_t lower = 0;
+	idx_t upper = count;
+	while (lower < upper) {
+		const auto middle = lower + (upper - lower) / 2;
+		uint32_t member_key_len;
+		auto member_key = GetObjectKey(val, ReadUInt32(sorted + middle * sizeof(uint32_t)), member_key_len);
+		if (CompareKeys(member_key, member_key_len, key, key_len) < 0) {
+			lower = middle + 1;
+		} else {
+			upper = middle;
+		}
+	}
+	if (lower == count) {
+		return nullptr;
+	}
+	const auto idx = ReadUInt32(sorted + lower * sizeof(uint32_t));
+	uint32_t member_key_len;
+	auto member_key = GetObjectKey(val, idx, member_key_len);
+	return CompareKeys(member_key, member_key_len, key, key_len) == 0 ? GetObjectValue(val, idx) : nullptr;
+}
+
+const char *JSONBinary::ValTypeToString(const_data_ptr_t val) {
+	switch (GetTag(val)) {
+	case JSONBinaryTag::JSON_NULL:
+		return JSONCommon::TYPE_STRING_NULL;
+	case JSONBinaryTag::JSON_FALSE:
+	case JSONBinaryTag::JSON_TRUE:
+		return JSONCommon::TYPE_STRING_BOOLEAN;
+	case JSONBinaryTag::UINT:
+		return JSONCommon::TYPE_STRING_UBIGINT;
+	case JSONBinaryTag::SINT:
+		return JSONCommon::TYPE_STRING_BIGINT;
+	case JSONBinaryTag::REAL:
+		return JSONCommon::TYPE_STRING_DOUBLE;
+	case JSONBinaryTag::STRING:
+		return JSONCommon::TYPE_STRING_VARCHAR;
+	case JSONBinaryTag::ARRAY:
+		return JSONCommon::TYPE_STRING_ARRAY;
+	case JSONBinaryTag::OBJECT:
+		return JSONCommon::TYPE_STRING_OBJECT;
+	default:
+		throw InternalException("Unexpected tag in JSONBinary::ValTypeToString");
+	}
+}
+
+//! Returns the size of the valid JSONB value that starts at val and has at most available bytes, or 0 if it is invalid
+static idx_t ValidateValue(const_data_ptr_t val, idx_t available) {
+	if (available == 0) {
+		return 0;
+	}
+	switch (JSONBinary::GetTag(val)) {
+	case JSONBinaryTag::JSON_NULL:
+	case JSONBinaryTag::JSON_FALSE:
+	case JSONBinaryTag::JSON_TRUE:
+		return 1;
+	case JSONBinaryTag::UINT:
+	case JSONBinaryTag::SINT:
+	case JSONBinaryTag::REAL:
+		return available >= 1 + sizeof(uint64_t) ? 1 + sizeof(uint64_t) : 0;
+	case JSONBinaryTag::STRING: {
+		if (available < 1 + sizeof(uint32_t)) {
+			return 0;
+		}
+		const idx_t size = 1 + sizeof(uint32_t) + JSONBinary::ReadUInt32(val + 1);
+		return size <= available ? size : 0;
+	}
+	case JSONBinaryTag::ARRAY:
+	case JSONBinaryTag::OBJECT:
+		break;
+	default:
+		return 0;
+	}
+	if (available < JSONBinary::CONTAINER_HEADER_SIZE) {
+		return 0;
+	}
+	const bool is_object = JSONBinary::GetTag(val) == JSONBinaryTag::OBJECT;
+	const idx_t size = JSONBinary::ReadUInt32(val + 1);
+	const idx_t count = JSONBinary::GetCount(val);
+	const idx_t header_size = JSONBinary::CONTAINER_HEADER_SIZE + count * (is_object ? 3 : 1) * sizeof(uint32_t);
+	if (size > available || header_size > size) {
+		return 0;
+	}
+	// The offsets must point after the header, and the children must be within the container
+	const auto entries = val + JSONBinary::CONTAINER_HEADER_SIZE;
+	for (idx_t i = 0; i < count; i++) {
+		if (is_object) {
+			const idx_t key_offset = JSONBinary::ReadUInt32(entries + i * 2 * sizeof(uint32_t));
+			if (key_offset < header_size || key_offset + sizeof(uint32_t) > size ||
+			    key_offset + sizeof(uint32_t) + JSONBinary::ReadUInt32(val + key_offset) > size) {
+				return 0;
+			}
+		}
+		const idx_t offset = JSONBinary::ReadUInt32(entries + (is_object ? i * 2 + 1 : i) * sizeof(uint32_t));
+		if (offset < header_size || offset >= size || ValidateValue(val + offset, size - offset) == 0) {
+			return 0;
+		}
+	}
+	if (!is_object) {
+		return size;
+	}
+	// The sorted member indexes must be in range and sorted by key, so that the binary search finds the members
+	const auto sorted = entries + count * 2 * sizeof(uint32_t);
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = JSONBinary::ReadUInt32(sorted + i * sizeof(uint32_t));
+		if (idx >= count) {
+			return 0;
+		}
+		if (i != 0) {
+			const auto prev_idx = JSONBinary::ReadUInt32(sorted + (i - 1) * sizeof(uint32_t));
+			uint32_t prev_len, len;
+			auto prev_key = JSONBinary::GetObjectKey(val, prev_idx, prev_len);
+			auto key = JSONBinary::GetObjectKey(val, idx, len);
+			const auto cmp = CompareKeys(prev_key, prev_len, key, len);
+			if (cmp > 0 || (cmp == 0 && prev_idx >= idx)) {
+				return 0;
+			}
+		}
+	}
+	return size;
+}
+
+bool JSONBinary::IsValid(const_data_ptr_t data, idx_t size) {
+	return ValidateValue(data, size) == size;
+}
+
+//===--------------------------------------------------------------------===//
+// JSON pointer / path
+//===--------------------------------------------------------------------===//
+const_data_ptr_t JSONBinary::Get(const_data_ptr_t val, const string_t &path_str) {
+	auto ptr = path_str.GetData();
+	auto len = path_str.GetSize();
+	if (len == 0) {
+		return GetUnsafe(val, ptr, len);
+	}
+	switch (*ptr) {
+	case '/':
+		return GetPointer(val, ptr, len);
+	case '$': {
+		if (JSONCommon::ValidatePath(ptr, len, false) == JSONCommon::JSONPathType::WILDCARD) {
+			throw InvalidInputException("JSON path cannot contain wildcards if the path is not a constant parameter");
+		}
+		return GetPath(val, ptr, len);
+	}
+	default:
+		auto str = "/" + string(ptr, len);
+		return GetPointer(val, str.c_str(), len + 1);
+	}
+}
+
+//! Reads the array index of a JSON pointer segment, in the same way as yyjson
+static const_data_ptr_t PointerReadArray(const char *&ptr, const char *const end, const_data_ptr_t arr) {
+	static constexpr idx_t IDX_T_SAFE_DIG = 19;
+	const char *const before = ptr;
+	const char *cur = ptr;
+	if (cur != end && *cur == '0') {
+		ptr = cur + 1;
+		return JSONBinary::GetArrayElementOrNull(arr, 0);
+	}
+	const char *const digits_end = end - cur > static_cast<int64_t>(IDX_T_SAFE_DIG) ? cur + IDX_T_SAFE_DIG : end;
+	idx_t idx = 0;
+	while (cur != digits_end && static_cast<uint8_t>(*cur - '0') <= 9) {
+		idx = idx * 10 + static_cast<uint8_t>(*cur - '0');
+		cur++;
+	}
+	if (cur == before) {
+		return nullptr;
+	}
+	ptr = cur;
+	return JSONBinary::GetArrayElementOrNull(arr, idx);
+}
+
+//! Reads the key of a JSON pointer segment ('~0' and '~1' are escapes for '~' and '/'), in the same way as yyjson
+static const_data_ptr_t PointerReadObject(const char *&ptr, const char *const end, const_data_ptr_t obj) {
+	const char *const before = ptr;
+	const char *cur = ptr;
+	while (cur != end && *cur != '/' && *cur != '~') {
+		cur++;
+	}
+	if (cur == end || *cur == '/') {
+		ptr = cur;
+		return JSONBinary::GetObjectMember(obj, before, cur - before);
+	}
+	string key(before, cur - before);
+	while (cur != end && *cur != '/') {
+		if (*cur != '~') {
+			key += *cur++;
+			continue;
+		}
+		cur++; // Skip past '~'
+		if (cur == end || (*cur != '0' && *cur != '1')) {
+			return nullptr;
+		}
+		key += *cur++ == '0' ? '~' : '/';
+	}
+	ptr = cur;
+	return JSONBinary::GetObjectMember(obj, key.c_str(), key.size());
+}
+
+const_data_ptr_t JSONBinary::GetPointer(const_data_ptr_t val, const char *ptr, const idx_t &len) {
+	if (len == 1) {
+		return val;
+	}
+	const char *const end = ptr + len;
+	ptr++; // Skip past '/'
+	while (true) {
+		switch (GetTag(val)) {
+		case JSONBinaryTag::OBJECT:
+			val = PointerReadObject(ptr, end, val);
+			break;
+		case JSONBinaryTag::ARRAY:
+			val = PointerReadArray(ptr, end, val);
+			break;
+		default:
+			return nullptr;
+		}
+		if (!val || ptr == end) {
+			return val;
+		}
+		if (*ptr++ != '/') {
+			return nullptr;
+		}
+	}
+}
+
+const_data_ptr_t JSONBinary::GetPath(const_data_ptr_t val, const char *ptr, const idx_t &len) {
+	// Path has been validated at this point
+	const char *const end = ptr + len;
+	ptr++; // Skip past '$'
+	while (val != nullptr && ptr != end) {
+		const auto &c = *ptr++;
+		D_ASSERT(ptr != end);
+		switch (c) {
+		case '.': { // Object field
+			if (GetTag(val) != JSONBinaryTag::OBJECT) {
+				return nullptr;
+			}
+			const char *key_ptr;
+			idx_t key_len;
+#ifdef DEBUG
+			bool success =
+#endif
+			    JSONCommon::ReadKey(ptr, end, key_ptr, key_len);
+#ifdef DEBUG
+			D_ASSERT(success);
+#endif
+			val = GetObjectMember(val, key_ptr, key_len);
+			break;
+		}
+		case '[': { // Array index
+			if (GetTag(val) != JSONBinaryTag::ARRAY) {
+				return nullptr;
+			}
+			idx_t array_index;
+			bool from_back;
+#ifdef DEBUG
+			bool success =
+#endif
+			    JSONCommon::ReadArrayIndex(ptr, end, array_index, from_back);
+#ifdef DEBUG
+			D_ASSERT(success);
+#endif
+			if (from_back && array_index != 0) {
+				array_index = GetCount(val) - array_index;
+			}
+			val = GetArrayElementOrNull(val, array_index);
+			break;
+		}
+		default: // LCOV_EXCL_START
+			throw InternalException(
+			    "Invalid JSON Path encountered in JSONBinary::GetPath, call JSONCommon::ValidatePath first!");
+		} // LCOV_EXCL_STOP
+	}
+	return val;
+}
+
+static void GetWildcardPathInternal(const_data_ptr_t val, const char *ptr, const char *const end,
+                                    vector<const_data_ptr_t> &vals) {
+	while (val != nullptr && ptr != end) {
+		const auto &c = *ptr++;
+		D_ASSERT(ptr != end);
+		switch (c) {
+		case '.': { // Object field
+			if (JSONBinary::GetTag(val) != JSONBinaryTag::OBJECT) {
+				return;
+			}
+			const char *key_ptr;
+			idx_t key_len;
+#ifdef DEBUG
+			bool success =
+#endif
+			    JSONCommon::ReadKey(ptr, end, key_ptr, key_len);
+#ifdef DEBUG
+			D_ASSERT(success);
+#endif
+			if (key_len == DConstants::INVALID_INDEX) { // Wildcard
+				for (idx_t i = 0; i < JSONBinary::GetCount(val); i++) {
+					GetWildcardPathInternal(JSONBinary::GetObjectValue(val, i), ptr, end, vals);
+				}
+				return;
+			}
+			val = JSONBinary::GetObjectMember(val, key_ptr, key_len);
+			break;
+		}
+		case '[': { // Array index
+			if (JSONBinary::GetTag(val) != JSONBinaryTag::ARRAY) {
+				return;
+			}
+			idx_t array_index;
+			bool from_back;
+#ifdef DEBUG
+			bool success =
+#endif
+			    JSONCommon::ReadArrayIndex(ptr, end, array_index, from_back);
+#ifdef DEBUG
+			D_ASSERT(success);
+#endif
+			if (array_index == DConstants::INVALID_INDEX) { // Wildcard
+				for (idx_t i = 0; i < JSONBinary::GetCount(val); i++) {
+					GetWildcardPathInternal(JSONBinary::GetArrayElement(val, i), ptr, end, vals);
+				}
+				return;
+			}
+			if (from_back && array_index != 0) {
+				array_index = JSONBinary::GetCount(val) - array_index;
+			}
+			val = JSONBinary::GetArrayElementOrNull(val, array_index);
+			break;
+		}
+		default: // LCOV_EXCL_START
+			throw InternalException(
+			    "Invalid JSON Path encountered in GetWildcardPathInternal, call JSONCommon::ValidatePath first!");
+		} // LCOV_EXCL_STOP
+	}
+	if (val != nullptr) {
+		vals.emplace_back(val);
+	}
+}
+
+void JSONBinary::GetWildcardPath(const_data_ptr_t val, const char *ptr, const idx_t &len,
+                                 vector<const_data_ptr_t> &vals) {
+	// Path has been validated at this point
+	const char *const end = ptr + len;
+	ptr++; // Skip past '$'
+	GetWildcardPathInternal(val, ptr, end, vals);
+}
+
+//===--------------------------------------------------------------------===//
+// Converting from/to text
+//===--------------------------------------------------------------------===//
+yyjson_mut_val *JSONBinary::ToMutVal(const_data_ptr_t val, yyjson_mut_doc *doc) {
+	switch (GetTag(val)) {
+	case JSONBinaryTag::JSON_NULL:
+		return yyjson_mut_null(doc);
+	case JSONBinaryTag::JSON_FALSE:
+		return yyjson_mut_false(doc);
+	case JSONBinaryTag::JSON_TRUE:
+		return yyjson_mut_true(doc);
+	case JSONBinaryTag::UINT:
+		return yyjson_mut_uint(doc, Load<uint64_t>(val + 1));
+	case JSONBinaryTag::SINT:
+		return yyjson_mut_sint(doc, Load<int64_t>(val + 1));
+	case JSONBinaryTag::REAL:
+		return yyjson_mut_real(doc, Load<double>(val + 1));
+	case JSONBinaryTag::STRING: {
+		uint32_t len;
+		auto str = GetString(val, len);
+		return yyjson_mut_strn(doc, str, len);
+	}
+	case JSONBinaryTag::ARRAY: {
+		auto arr = yyjson_mut_arr(doc);
+		for (idx_t i = 0; i < GetCount(val); i++) {
+			yyjson_mut_arr_append(arr, ToMutVal(GetArrayElement(val, i), doc));
+		}
+		return arr;
+	}
+	case JSONBinaryTag::OBJECT: {
+		auto obj = yyjson_mut_obj(doc);
+		for (idx_t i = 0; i < GetCount(val); i++) {
+			uint32_t key_len;
+			auto key = GetObjectKey(val, i, key_len);
+			yyjson_mut_obj_add(obj, yyjson_mut_strn(doc, key, key_len), ToMutVal(GetObjectValue(val, i), doc));
+		}
+		return obj;
+	}
+	default:
+		throw InternalException("Unexpected tag in JSONBinary::ToMutVal");
+	}
+}
+
+string_t JSONBinary::ToText(const_data_ptr_t val, yyjson_alc *alc) {
+	auto doc = JSONCommon::CreateDocument(alc);
+	return JSONCommon::WriteVal<yyjson_mut_val>(ToMutVal(val, doc), alc);
+}
+
+string_t JSONBinaryWriter::Write(yyjson_doc *doc, Vector &result) {
+	// The strings are at most as long as the input, and every value (including the keys) takes at most MAX_VALUE_SIZE
+	const idx_t max_size = yyjson_doc_get_read_size(doc) + yyjson_doc_get_val_count(doc) * MAX_VALUE_SIZE;
+	if (max_size > capacity) {
+		capacity = NextPowerOfTwo(max_size);
+		buffer = make_unsafe_uniq_array<data_t>(capacity);
+	}
+	size = 0;
+	WriteVal(yyjson_doc_get_root(doc));
+	D_ASSERT(size <= max_size);
+	if (size > NumericLimits<uint32_t>::Maximum()) {
+		throw InvalidInputException("JSON document of %llu bytes is too large to be converted to JSONB", size);
+	}
+	return StringVector::AddStringOrBlob(result, const_char_ptr_cast(buffer.get()), size);
+}
+
+bool JSONBinaryWriter::SortKeyLessThan(const SortKey &lhs, const SortKey &rhs) {
+	if (lhs.prefix != rhs.prefix) {
+		return lhs.prefix < rhs.prefix;
+	}
+	const auto cmp = CompareKeys(lhs.ptr, lhs.len, rhs.ptr, rhs.len);
+	return cmp < 0 || (cmp == 0 && lhs.idx < rhs.idx);
+}
+
+void JSONBinaryWriter::WriteVal(yyjson_val *val) {
+	switch (yyjson_get_tag(val)) {
+	case YYJSON_TYPE_NULL | YYJSON_SUBTYPE_NONE:
+		Append<uint8_t>(static_cast<uint8_t>(JSONBinaryTag::JSON_NULL));
+		break;
+	case YYJSON_TYPE_BOOL | YYJSON_SUBTYPE_FALSE:
+		Append<uint8_t>(static_cast<uint8_t>(JSONBinaryTag::JSON_FALSE));
+		break;
+	case YYJSON_TYPE_BOOL | YYJSON_SUBTYPE_TRUE:
+		Append<uint8_t>(static_cast<uint8_t>(JSONBinaryTag::JSON_TRUE));
+		break;
+	case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_UINT:
+		Append<uint8_t>(static_cast<uint8_t>(JSONBinaryTag::UINT));
+		Append<uint64_t>(unsafe_yyjson_get_uint(val));
+		break;
+	case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_SINT:
+		Append<uint8_t>(static_cast<uint8_t>(JSONBinaryTag::SINT));
+		Append<int64_t>(unsafe_yyjson_get_sint(val));
+		break;
+	case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_REAL:
+		Append<uint8_t>(static_cast<uint8_t>(JSONBinaryTag::REAL));
+		Append<double>(unsafe_yyjson_get_real(val));
+		break;
+	case YYJSON_TYPE_STR | YYJSON_SUBTYPE_NONE:
+		Append<uint8_t>(static_cast<uint8_t>(JSONBinaryTag::STRING));
+		AppendString(unsafe_yyjson_get_str(val), unsafe_yyjson_get_len(val));
+		break;
+	case YYJSON_TYPE_ARR | YYJSON_SUBTYPE_NONE: {
+		const auto count = unsafe_yyjson_get_len(val);
+		const auto start = size;
+		size += JSONBinary::CONTAINER_HEADER_SIZE + count * sizeof(uint32_t);
+		buffer[start] = static_cast<uint8_t>(JSONBinaryTag::ARRAY);
+		StoreAt<uint32_t>(UnsafeNumericCast<uint32_t>(count), start + 5);
+		size_t idx, max;
+		yyjson_val *child_val;
+		yyjson_arr_foreach(val, idx, max, child_val) {
+			const auto offset_pos = start + JSONBinary::CONTAINER_HEADER_SIZE + idx * sizeof(uint32_t);
+			StoreAt<uint32_t>(UnsafeNumericCast<uint32_t>(size - start), offset_pos);
+			WriteVal(child_val);
+		}
+		StoreAt<uint32_t>(UnsafeNumericCast<uint32_t>(size - start), start + 1);
+		break;
+	}
+	case YYJSON_TYPE_OBJ | YYJSON_SUBTYPE_NONE: {
+		const auto count = unsafe_yyjson_get_len(val);
+		const auto start = size;
+		size += JSONBinary::CONTAINER_HEADER_SIZE + count * 3 * sizeof(uint32_t);
+		buffer[start] = static_cast<uint8_t>(JSONBinaryTag::OBJECT);
+		StoreAt<uint32_t>(UnsafeNumericCast<uint32_t>(count), start + 5);
+		size_t idx, max;
+		yyjson_val *key, *child_val;
+		yyjson_obj_foreach(val, idx, max, key, child_val) {
+			const auto offset_pos = start + JSONBinary::CONTAINER_HEADER_SIZE + idx * 2 * sizeof(uint32_t);
+			StoreAt<uint32_t>(UnsafeNumericCast<uint32_t>(size - start), offset_pos);
+			AppendString(unsafe_yyjson_get_str(key), unsafe_yyjson_get_len(key));
+			StoreAt<uint32_t>(UnsafeNumericCast<uint32_t>(size - start), offset_pos + sizeof(uint32_t));
+			WriteVal(child_val);
+		}
+		StoreAt<uint32_t>(UnsafeNumericCast<uint32_t>(size - start), start + 1);
+
+		// Sort the member indexes by key (and by index for duplicate keys)
+		sort_buffer.resize(count);
+		bool sorted = true;
+		yyjson_obj_foreach(val, idx, max, key, child_val) {
+			auto &sort_key = sort_buffer[idx];
+			sort_key.ptr = unsafe_yyjson_get_str(key);
+			sort_key.len = unsafe_yyjson_get_len(key);
+			sort_key.idx = UnsafeNumericCast<uint32_t>(idx);
+			// The big-endian prefix of the key compares like the first bytes of the key
+			uint64_t prefix = 0;
+			memcpy(&prefix, sort_key.ptr, MinValue<idx_t>(sort_key.len, sizeof(uint64_t)));
+			sort_key.prefix = BSwap(prefix);
+			sorted = sorted && (idx == 0 || !SortKeyLessThan(sort_key, sort_buffer[idx - 1]));
+		}
+		if (sorted) {
+			// Nothing to do
+		} else if (count <= INSERTION_SORT_THRESHOLD) {
+			// Objects are usually small, use an insertion sort
+			for (idx_t i = 1; i < count; i++) {
+				auto sort_key = sort_buffer[i];
+				idx_t j = i;
+				for (; j > 0 && SortKeyLessThan(sort_key, sort_buffer[j - 1]); j--) {
+					sort_buffer[j] = sort_buffer[j - 1];
+				}
+				sort_buffer[j] = sort_key;
+			}
+		} else {
+			std::sort(sort_buffer.begin(), sort_buffer.end(), SortKeyLessThan);
+		}
+		const auto sorted_pos = start + JSONBinary::CONTAINER_HEADER_SIZE + count * 2 * sizeof(uint32_t);
+		for (idx_t i = 0; i < count; i++) {
+			StoreAt<uint32_t>(sort_buffer[i].idx, sorted_pos + i * sizeof(uint32_t));
+		}
+		break;
+	}
+	default:
+		throw InternalException("Unexpected yyjson tag in JSONBinaryWriter::WriteVal");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Casts
+//===--------------------------------------------------------------------===//
+struct JSONBinaryCastLocalState : public FunctionLocalState {
+public:
+	explicit JSONBinaryCastLocalState(Allocator &allocator) : json_allocator(allocator) {
+	}
+	static unique_ptr<FunctionLocalState> Init(CastLocalStateParameters &parameters) {
+		return parameters.context ? make_uniq<JSONBinaryCastLocalState>(BufferAllocator::Get(*parameters.context))
+		                          : make_uniq<JSONBinaryCastLocalState>(Allocator::DefaultAllocator());
+	}
+
+public:
+	JSONAllocator json_allocator;
+	JSONBinaryWriter writer;
+};
+
+static bool CastJSONToJSONB(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	auto &lstate = parameters.local_state->Cast<JSONBinaryCastLocalState>();
+	lstate.json_allocator.Reset();
+	auto alc = lstate.json_allocator.GetYYAlc();
+
+	bool success = true;
+	UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
+	    source, result, count, [&](string_t input, ValidityMask &mask, idx_t idx) {
+		    auto data = input.GetDataWriteable();
+		    const auto length = input.GetSize();
+
+		    yyjson_read_err error;
+		    auto doc = JSONCommon::ReadDocumentUnsafe(data, length, JSONCommon::READ_FLAG, alc, &error);
+
+		    if (!doc) {
+			    mask.SetInvalid(idx);
+			    if (success) {
+				    HandleCastError::AssignError(JSONCommon::FormatParseError(data, length, error), parameters);
+				    success = false;
+			    }
+			    return string_t();
+		    }
+		    return lstate.writer.Write(doc, result);
+	    });
+	return success;
+}
+
+static bool CastJSONBToJSON(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	auto &lstate = parameters.local_state->Cast<JSONFunctionLocalState>();
+	lstate.json_allocator.Reset();
+	auto alc = lstate.json_allocator.GetYYAlc();
+
+	UnaryExecutor::Execute<string_t, string_t>(source, result, count, [&](string_t input) {
+		return StringVector::AddString(result, JSONBinary::ToText(const_data_ptr_cast(input.GetData()), alc));
+	});
+	return true;
+}
+
+static bool CastBlobToJSONB(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	bool success = true;
+	UnaryExecutor::ExecuteWithNulls<string_t, string_t>(
+	    source, result, count, [&](string_t input, ValidityMask &mask, idx_t idx) {
+		    if (!JSONBinary::IsValid(const_data_ptr_cast(input.GetData()), input.GetSize())) {
+			    mask.SetInvalid(idx);
+			    if (success) {
+				    HandleCastError::AssignError("BLOB is not a valid JSONB document", parameters);
+				    success = false;
+			    }
+		    }
+		    return input;
+	    });
+	StringVector::AddHeapReference(result, source);
+	return success;
+}
+
+struct JSONBinaryToAnyBoundCastData : public BoundCastData {
+	explicit JSONBinaryToAnyBoundCastData(BoundCastInfo json_cast_p) : json_cast(std::move(json_cast_p)) {
+	}
+
+	//! The cast from the JSON text to the target type
+	BoundCastInfo json_cast;
+
+public:
+	unique_ptr<BoundCastData> Copy() const override {
+		return make_uniq<JSONBinaryToAnyBoundCastData>(json_cast.Copy());
+	}
+};
+
+struct JSONBinaryToAnyLocalState : public FunctionLocalState {
+public:
+	explicit JSONBinaryToAnyLocalState(Allocator &allocator) : json_allocator(allocator) {
+	}
+	static unique_ptr<FunctionLocalState> Init(CastLocalStateParameters &parameters) {
+		auto result = parameters.context
+		                  ? make_uniq<JSONBinaryToAnyLocalState>(BufferAllocator::Get(*parameters.context))
+		                  : make_uniq<JSONBinaryToAnyLocalState>(Allocator::DefaultAllocator());
+		auto &cast_data = parameters.cast_data->Cast<JSONBinaryToAnyBoundCastData>();
+		if (cast_data.json_cast.init_local_state) {
+			CastLocalStateParameters json_parameters(parameters, cast_data.json_cast.cast_data);
+			result->json_cast_state = cast_data.json_cast.init_local_state(json_parameters);
+		}
+		return std::move(result);
+	}
+
+public:
+	JSONAllocator json_allocator;
+	unique_ptr<FunctionLocalState> json_cast_state;
+};
+
+static bool CastJSONBToAny(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	auto &cast_data = parameters.cast_data->Cast<JSONBinaryToAnyBoundCastData>();
+	auto &lstate = parameters.local_state->Cast<JSONBinaryToAnyLocalState>();
+	lstate.json_allocator.Reset();
+	auto alc = lstate.json_allocator.GetYYAlc();
+
+	// Convert to JSON text first, and then use the JSON cast, so JSONB converts to every type like JSON does
+	Vector json_vector(LogicalType::JSON(), count);
+	UnaryExecutor::Execute<string_t, string_t>(source, json_vector, count, [&](string_t input) {
+		return StringVector::AddString(json_vector, JSONBinary::ToText(const_data_ptr_cast(input.GetData()), alc));
+	});
+	CastParameters json_parameters(parameters, cast_data.json_cast.cast_data, lstate.json_cast_state);
+	return cast_data.json_cast.function(json_vector, result, count, json_parameters);
+}
+
+static BoundCastInfo JSONBToAnyCastBind(BindCastInput &input, const LogicalType &source, const LogicalType &target) {
+	auto json_cast = input.GetCastFunction(LogicalType::JSON(), target);
+	return BoundCastInfo(CastJSONBToAny, make_uniq<JSONBinaryToAnyBoundCastData>(std::move(json_cast)),
+	                     JSONBinaryToAnyLocalState::Init);
+}
+
+void JSONFunctions::RegisterJSONBinaryCastFunctions(CastFunctionSet &casts) {
+	const auto jsonb_type = JSONBinary::GetType();
+
+	// VARCHAR/JSON to JSONB requires a parse, so it must be done explicitly
+	for (auto &source_type : vector<LogicalType> {LogicalType::VARCHAR, LogicalType::JSON()}) {
+		BoundCastInfo to_jsonb_info(CastJSONToJSONB, nullptr, JSONBinaryCastLocalState::Init);
+		casts.RegisterCastFunction(source_type, jsonb_type, std::move(to_jsonb_info));
+	}
+
+	// JSONB to JSON can be done implicitly, so that the JSON functions that do not have a JSONB overload can be used
+	auto jsonb_to_json_cost = casts.ImplicitCastCost(LogicalType::SQLNULL, LogicalTypeId::STRUCT) + 1;
+	BoundCastInfo to_json_info(CastJSONBToJSON, nullptr, JSONFunctionLocalState::InitCastLocalState);
+	casts.RegisterCastFunction(jsonb_type, LogicalType::JSON(), std::move(to_json_info), jsonb_to_json_cost);
+	BoundCastInfo to_varchar_info(CastJSONBToJSON, nullptr, JSONFunctionLocalState::InitCastLocalState);
+	casts.RegisterCastFunction(jsonb_type, LogicalType::VARCHAR, std::move(to_varchar_info));
+
+	// JSONB to BLOB is free, BLOB to JSONB has to validate the BLOB
+	casts.RegisterCastFunction(jsonb_type, LogicalType::BLOB, DefaultCasts::ReinterpretCast, 1);
+	casts.RegisterCastFunction(LogicalType::BLOB, jsonb_type, CastBlobToJSONB);
+
+	// JSONB can be cast to anything that JSON can be cast to, but only explicitly
+	for (const auto &type : LogicalType::AllTypes()) {
+		LogicalType target_type;
+		switch (type.id()) {
+		case LogicalTypeId::STRUCT:
+			target_type = LogicalType::STRUCT({{"any", LogicalType::ANY}});
+			break;
+		case LogicalTypeId::LIST:
+			target_type = LogicalType::LIST(LogicalType::ANY);
+			break;
+		case LogicalTypeId::MAP:
+			target_type = LogicalType::MAP(LogicalType::ANY, LogicalType::ANY);
+			break;
+		case LogicalTypeId::UNION:
+			target_type = LogicalType::UNION({{"any", LogicalType::ANY}});
+			break;
+		case LogicalTypeId::ARRAY:
+			target_type = LogicalType::ARRAY(LogicalType::ANY);
+			break;
+		case LogicalTypeId::VARCHAR:
+		case LogicalTypeId::BLOB:
+			// These are registered above
+			continue;
+		default:
+			target_type = type;
+		}
+		casts.RegisterCastFunction(jsonb_type, target_type, JSONBToAnyCastBind);
+	}
+
+	// Register NULL to JSONB with a higher cost than NULL to JSON so the binder prefers the JSON functions
+	auto null_to_jsonb_cost = casts.ImplicitCastCost(LogicalType::SQLNULL, LogicalType::JSON()) + 1;
+	casts.RegisterCastFunction(LogicalType::SQLNULL, jsonb_type, DefaultCasts::TryVectorNullCast, null_to_jsonb_cost);
+}
+
+//===--------------------------------------------------------------------===//
+// Optimizer
+//===--------------------------------------------------------------------===//
+//! The JSON read functions that have a JSONB overload with the same return type (except for JSON, which becomes JSONB)
+static const case_insensitive_set_t JSONB_FUNCTION_NAMES {
+    "json_extract", "json_extract_path", "json_extract_string", "json_extract_path_text", "->>",
+    "json_keys",    "json_type",         "json_array_length"};
+
+struct JSONBinaryOptimizerState {
+	//! The extractions, grouped by the column that they extract from
+	column_binding_map_t<idx_t> group_map;
+	vector<vector<reference<unique_ptr<Expression>>>> groups;
+};
+
+static bool IsJSONBinaryCandidate(const Expression &expr) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+		return false;
+	}
+	auto &func_expr = expr.Cast<BoundFunctionExpression>();
+	if (func_expr.children.empty() || JSONB_FUNCTION_NAMES.count(func_expr.function.name) == 0) {
+		return false;
+	}
+	auto &input = *func_expr.children[0];
+	return input.GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF &&
+	       (input.return_type == LogicalType::VARCHAR || input.return_type.IsJSONType());
+}
+
+static void CollectExtractions(unique_ptr<Expression> &expr, JSONBinaryOptimizerState &state) {
+	switch (expr->GetExpressionClass()) {
+	// like common subexpression elimination, skip conjunctions and case, which would evaluate the conversion eagerly
+	case ExpressionClass::BOUND_CONJUNCTION:
+	case ExpressionClass::BOUND_CASE:
+		return;
+	default:
+		break;
+	}
+	if (IsJSONBinaryCandidate(*expr)) {
+		auto &column_ref = expr->Cast<BoundFunctionExpression>().children[0]->Cast<BoundColumnRefExpression>();
+		auto entry = state.group_map.find(column_ref.binding);
+		if (entry == state.group_map.end()) {
+			entry = state.group_map.emplace(column_ref.binding, state.groups.size()).first;
+			state.groups.emplace_back();
+		}
+		state.groups[entry->second].push_back(expr);
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(*expr,
+	                                      [&](unique_ptr<Expression> &child) { CollectExtractions(child, state); });
+}
+
+static void RewriteExtraction(ClientContext &context, unique_ptr<Expression> &expr) {
+	auto &func_expr = expr->Cast<BoundFunctionExpression>();
+	vector<unique_ptr<Expression>> children;
+	auto input = func_expr.children[0]->Copy();
+	children.push_back(BoundCastExpression::AddCastToType(context, std::move(input), JSONBinary::GetType()));
+	for (idx_t i = 1; i < func_expr.children.size(); i++) {
+		children.push_back(func_expr.children[i]->Copy());
+	}
+	FunctionBinder function_binder(context);
+	ErrorData error;
+	auto result =
+	    function_binder.BindScalarFunction(DEFAULT_SCHEMA, func_expr.function.name, std::move(children), error);
+	if (!result) {
+		return; // Leave the extraction as it is
+	}
+	if (result->return_type != func_expr.return_type) {
+		// JSONB extractions return JSONB, convert them back to JSON so the types of the plan do not change
+		result = BoundCastExpression::AddCastToType(context, std::move(result), func_expr.return_type);
+	}
+	result->alias = func_expr.alias;
+	expr = std::move(result);
+}
+
+static void OptimizeOperator(ClientContext &context, LogicalOperator &op) {
+	switch (op.type) {
+	case LogicalOperatorType::LOGICAL_PROJECTION:
+	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
+		break;
+	default:
+		return;
+	}
+	JSONBinaryOptimizerState state;
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    op, [&](unique_ptr<Expression> *child) { CollectExtractions(*child, state); });
+	for (auto &group : state.groups) {
+		// Converting to JSONB costs about as much as parsing twice, so it only pays off for enough distinct extractions
+		expression_set_t distinct_extractions;
+		for (auto &expr : group) {
+			distinct_extractions.insert(*expr.get());
+		}
+		if (distinct_extractions.size() < JSONBinaryOptimizer::MIN_DISTINCT_EXTRACTIONS) {
+			continue;
+		}
+		for (auto &expr : group) {
+			RewriteExtraction(context, expr.get());
+		}
+	}
+}
+
+static void OptimizeRecursive(ClientContext &context, LogicalOperator &op) {
+	for (auto &child : op.children) {
+		OptimizeRecursive(context, *child);
+	}
+	OptimizeOperator(context, op);
+}
+
+void JSONBinaryOptimizer::Optimize(ClientContext &context, OptimizerExtensionInfo *info,
+                                   unique_ptr<LogicalOperator> &plan) {
+	OptimizeRecursive(context, *plan);
+}
+
+OptimizerExtension JSONBinaryOptimizer::GetOptimizerExtension() {
+	OptimizerExtension extension;
+	extension.pre_optimize_function = Optimize;
+	return extension;
+}
+
+} // namespace duckdb
@@ -79,7 +79,7 @@ static inline idx_t ReadInteger(const char *ptr, const char *const end, idx_t &i
 	return idx >= (idx_t)IDX_T_MAX ? 0 : ptr - before;
 }
 
-static inline bool ReadKey(const char *&ptr, const char *const end, const char *&key_ptr, idx_t &key_len) {
+bool JSONCommon::ReadKey(const char *&ptr, const char *const end, const char *&key_ptr, idx_t &key_len) {
 	D_ASSERT(ptr != end);
 	if (*ptr == '*') { // Wildcard
 		ptr++;
@@ -103,7 +103,7 @@ static inline bool ReadKey(const char *&ptr, const char *const end, const char *
 	return true;
 }
 
-static inline bool ReadArrayIndex(const char *&ptr, const char *const end, idx_t &array_index, bool &from_back) {
+bool JSONCommon::ReadArrayIndex(const char *&ptr, const char *const end, idx_t &array_index, bool &from_back) {
 	D_ASSERT(ptr != end);
 	from_back = false;
 	if (*ptr == '*') { // Wildcard
@@ -248,7 +248,7 @@ void GetWildcardPathInternal(yyjson_val *val, const char *ptr, const char *const
 #ifdef DEBUG
 			bool success =
 #endif
-			    ReadKey(ptr, end, key_ptr, key_len);
+			    JSONCommon::ReadKey(ptr, end, key_ptr, key_len);
 #ifdef DEBUG
 			D_ASSERT(success);
 #endif
@@ -272,7 +272,7 @@ void GetWildcardPathInternal(yyjson_val *val, const char *ptr, const char *const
 #ifdef DEBUG
 			bool success =
 #endif
-			    ReadArrayIndex(ptr, end, array_index, from_back);
+			    JSONCommon::ReadArrayIndex(ptr, end, array_index, from_back);
 #ifdef DEBUG
 			D_ASSERT(success);
 #endif
@@ -11,8 +11,10 @@ source_files = [
         'extension/json/buffered_json_reader.cpp',
         'extension/json/json_enums.cpp',
         'extension/json/json_extension.cpp',
+        'extension/json/json_binary.cpp',
         'extension/json/json_common.cpp',
         'extension/json/json_functions.cpp',
+        'extension/json/json_path_statistics.cpp',
         'extension/json/json_scan.cpp',
         'extension/json/json_functions/copy_json.cpp',
         'extension/json/json_functions/json_array_length.cpp',
@@ -11,8 +11,10 @@
 #include "duckdb/parser/parsed_data/create_pragma_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_type_info.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
+#include "json_binary.hpp"
 #include "json_common.hpp"
 #include "json_functions.hpp"
+#include "json_path_statistics.hpp"
 
 namespace duckdb {
 
@@ -29,10 +31,14 @@ void JsonExtension::Load(DuckDB &db) {
 	auto json_type = LogicalType::JSON();
 	ExtensionUtil::RegisterType(db_instance, LogicalType::JSON_TYPE_NAME, std::move(json_type));
 
+	// JSONB type
+	ExtensionUtil::RegisterType(db_instance, JSONBinary::TYPE_NAME, JSONBinary::GetType());
+
 	// JSON casts
 	JSONFunctions::RegisterSimpleCastFunctions(DBConfig::GetConfig(db_instance).GetCastFunctions());
 	JSONFunctions::RegisterJSONCreateCastFunctions(DBConfig::GetConfig(db_instance).GetCastFunctions());
 	JSONFunctions::RegisterJSONTransformCastFunctions(DBConfig::GetConfig(db_instance).GetCastFunctions());
+	JSONFunctions::RegisterJSONBinaryCastFunctions(DBConfig::GetConfig(db_instance).GetCastFunctions());
 
 	// JSON scalar functions
 	for (auto &fun : JSONFunctions::GetScalarFunctions()) {
@@ -53,6 +59,13 @@ void JsonExtension::Load(DuckDB &db) {
 	auto &config = DBConfig::GetConfig(*db.instance);
 	config.replacement_scans.emplace_back(JSONFunctions::ReadJSONReplacement);
 
+	// JSON optimizer, which merges extractions from the same column into a single parse
+	config.optimizer_extensions.push_back(JSONBinaryOptimizer::GetOptimizerExtension());
+
+	// JSON path statistics, which are computed at checkpoint and allow filters on extracted values to skip row groups
+	config.json_path_statistics_analyzer = JSONPathStatisticsCollector::Create;
+	config.optimizer_extensions.push_back(JSONPathFilterOptimizer::GetOptimizerExtension());
+
 	// JSON copy function
 	auto copy_fun = JSONFunctions::GetJSONCopyFunction();
 	ExtensionUtil::RegisterFunction(db_instance, std::move(copy_fun));
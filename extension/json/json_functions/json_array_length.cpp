@@ -6,6 +6,10 @@ static inline uint64_t GetArrayLength(yyjson_val *val, yyjson_alc *alc, Vector &
 	return yyjson_arr_size(val);
 }
 
+static inline uint64_t GetJSONBArrayLength(const_data_ptr_t val, yyjson_alc *alc, Vector &result) {
+	return JSONBinary::GetTag(val) == JSONBinaryTag::ARRAY ? JSONBinary::GetCount(val) : 0;
+}
+
 static void UnaryArrayLengthFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	JSONExecutors::UnaryExecute<uint64_t>(args, state, result, GetArrayLength);
 }
@@ -18,6 +22,18 @@ static void ManyArrayLengthFunction(DataChunk &args, ExpressionState &state, Vec
 	JSONExecutors::ExecuteMany<uint64_t>(args, state, result, GetArrayLength);
 }
 
+static void UnaryArrayLengthJSONBFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONBinaryExecutors::UnaryExecute<uint64_t>(args, state, result, GetJSONBArrayLength);
+}
+
+static void BinaryArrayLengthJSONBFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONBinaryExecutors::BinaryExecute<uint64_t>(args, state, result, GetJSONBArrayLength);
+}
+
+static void ManyArrayLengthJSONBFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONBinaryExecutors::ExecuteMany<uint64_t>(args, state, result, GetJSONBArrayLength);
+}
+
 static void GetArrayLengthFunctionsInternal(ScalarFunctionSet &set, const LogicalType &input_type) {
 	set.AddFunction(ScalarFunction({input_type}, LogicalType::UBIGINT, UnaryArrayLengthFunction, nullptr, nullptr,
 	                               nullptr, JSONFunctionLocalState::Init));
@@ -32,6 +48,16 @@ ScalarFunctionSet JSONFunctions::GetArrayLengthFunction() {
 	ScalarFunctionSet set("json_array_length");
 	GetArrayLengthFunctionsInternal(set, LogicalType::VARCHAR);
 	GetArrayLengthFunctionsInternal(set, LogicalType::JSON());
+
+	const auto jsonb = JSONBinary::GetType();
+	set.AddFunction(ScalarFunction({jsonb}, LogicalType::UBIGINT, UnaryArrayLengthJSONBFunction, nullptr, nullptr,
+	                               nullptr, JSONFunctionLocalState::Init));
+	set.AddFunction(ScalarFunction({jsonb, LogicalType::VARCHAR}, LogicalType::UBIGINT,
+	                               BinaryArrayLengthJSONBFunction, JSONReadFunctionData::Bind, nullptr, nullptr,
+	                               JSONFunctionLocalState::Init));
+	set.AddFunction(ScalarFunction({jsonb, LogicalType::LIST(LogicalType::VARCHAR)},
+	                               LogicalType::LIST(LogicalType::UBIGINT), ManyArrayLengthJSONBFunction,
+	                               JSONReadManyFunctionData::Bind, nullptr, nullptr, JSONFunctionLocalState::Init));
 	return set;
 }
 
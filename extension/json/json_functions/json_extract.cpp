@@ -11,6 +11,19 @@ static inline string_t ExtractStringFromVal(yyjson_val *val, yyjson_alc *alc, Ve
 	                          : JSONCommon::WriteVal<yyjson_val>(val, alc);
 }
 
+static inline string_t ExtractFromJSONB(const_data_ptr_t val, yyjson_alc *, Vector &result) {
+	return StringVector::AddStringOrBlob(result, const_char_ptr_cast(val), JSONBinary::GetSize(val));
+}
+
+static inline string_t ExtractStringFromJSONB(const_data_ptr_t val, yyjson_alc *alc, Vector &result) {
+	if (JSONBinary::GetTag(val) != JSONBinaryTag::STRING) {
+		return JSONBinary::ToText(val, alc);
+	}
+	uint32_t len;
+	auto str = JSONBinary::GetString(val, len);
+	return StringVector::AddString(result, str, len);
+}
+
 static void ExtractFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	JSONExecutors::BinaryExecute<string_t>(args, state, result, ExtractFromVal);
 }
@@ -27,6 +40,22 @@ static void ExtractStringManyFunction(DataChunk &args, ExpressionState &state, V
 	JSONExecutors::ExecuteMany<string_t>(args, state, result, ExtractStringFromVal);
 }
 
+static void ExtractJSONBFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONBinaryExecutors::BinaryExecute<string_t>(args, state, result, ExtractFromJSONB);
+}
+
+static void ExtractManyJSONBFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONBinaryExecutors::ExecuteMany<string_t>(args, state, result, ExtractFromJSONB);
+}
+
+static void ExtractStringJSONBFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONBinaryExecutors::BinaryExecute<string_t>(args, state, result, ExtractStringFromJSONB);
+}
+
+static void ExtractStringManyJSONBFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONBinaryExecutors::ExecuteMany<string_t>(args, state, result, ExtractStringFromJSONB);
+}
+
 static void GetExtractFunctionsInternal(ScalarFunctionSet &set, const LogicalType &input_type) {
 	set.AddFunction(ScalarFunction({input_type, LogicalType::BIGINT}, LogicalType::JSON(), ExtractFunction,
 	                               JSONReadFunctionData::Bind, nullptr, nullptr, JSONFunctionLocalState::Init));
@@ -42,6 +71,16 @@ ScalarFunctionSet JSONFunctions::GetExtractFunction() {
 	ScalarFunctionSet set("json_extract");
 	GetExtractFunctionsInternal(set, LogicalType::VARCHAR);
 	GetExtractFunctionsInternal(set, LogicalType::JSON());
+
+	// Extracting from JSONB returns JSONB
+	const auto jsonb = JSONBinary::GetType();
+	set.AddFunction(ScalarFunction({jsonb, LogicalType::BIGINT}, jsonb, ExtractJSONBFunction,
+	                               JSONReadFunctionData::Bind, nullptr, nullptr, JSONFunctionLocalState::Init));
+	set.AddFunction(ScalarFunction({jsonb, LogicalType::VARCHAR}, jsonb, ExtractJSONBFunction,
+	                               JSONReadFunctionData::Bind, nullptr, nullptr, JSONFunctionLocalState::Init));
+	set.AddFunction(ScalarFunction({jsonb, LogicalType::LIST(LogicalType::VARCHAR)}, LogicalType::LIST(jsonb),
+	                               ExtractManyJSONBFunction, JSONReadManyFunctionData::Bind, nullptr, nullptr,
+	                               JSONFunctionLocalState::Init));
 	return set;
 }
 
@@ -60,6 +99,15 @@ ScalarFunctionSet JSONFunctions::GetExtractStringFunction() {
 	ScalarFunctionSet set("json_extract_string");
 	GetExtractStringFunctionsInternal(set, LogicalType::VARCHAR);
 	GetExtractStringFunctionsInternal(set, LogicalType::JSON());
+
+	const auto jsonb = JSONBinary::GetType();
+	set.AddFunction(ScalarFunction({jsonb, LogicalType::BIGINT}, LogicalType::VARCHAR, ExtractStringJSONBFunction,
+	                               JSONReadFunctionData::Bind, nullptr, nullptr, JSONFunctionLocalState::Init));
+	set.AddFunction(ScalarFunction({jsonb, LogicalType::VARCHAR}, LogicalType::VARCHAR, ExtractStringJSONBFunction,
+	                               JSONReadFunctionData::Bind, nullptr, nullptr, JSONFunctionLocalState::Init));
+	set.AddFunction(ScalarFunction({jsonb, LogicalType::LIST(LogicalType::VARCHAR)},
+	                               LogicalType::LIST(LogicalType::VARCHAR), ExtractStringManyJSONBFunction,
+	                               JSONReadManyFunctionData::Bind, nullptr, nullptr, JSONFunctionLocalState::Init));
 	return set;
 }
 
@@ -26,6 +26,31 @@ static inline list_entry_t GetJSONKeys(yyjson_val *val, yyjson_alc *alc, Vector
 	return {current_size, num_keys};
 }
 
+static inline list_entry_t GetJSONBKeys(const_data_ptr_t val, yyjson_alc *alc, Vector &result) {
+	auto num_keys = JSONBinary::GetTag(val) == JSONBinaryTag::OBJECT ? JSONBinary::GetCount(val) : 0;
+	auto current_size = ListVector::GetListSize(result);
+	auto new_size = current_size + num_keys;
+
+	// Grow list if needed
+	if (ListVector::GetListCapacity(result) < new_size) {
+		ListVector::Reserve(result, new_size);
+	}
+
+	// Write the strings to the child vector
+	auto &child = ListVector::GetEntry(result);
+	auto keys = FlatVector::GetData<string_t>(child);
+	for (idx_t idx = 0; idx < num_keys; idx++) {
+		uint32_t key_len;
+		auto key = JSONBinary::GetObjectKey(val, idx, key_len);
+		keys[current_size + idx] = StringVector::AddString(child, key, key_len);
+	}
+
+	// Update size
+	ListVector::SetListSize(result, current_size + num_keys);
+
+	return {current_size, num_keys};
+}
+
 static void UnaryJSONKeysFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	JSONExecutors::UnaryExecute<list_entry_t>(args, state, result, GetJSONKeys);
 }
@@ -38,6 +63,18 @@ static void ManyJSONKeysFunction(DataChunk &args, ExpressionState &state, Vector
 	JSONExecutors::ExecuteMany<list_entry_t>(args, state, result, GetJSONKeys);
 }
 
+static void UnaryJSONBKeysFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONBinaryExecutors::UnaryExecute<list_entry_t>(args, state, result, GetJSONBKeys);
+}
+
+static void BinaryJSONBKeysFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONBinaryExecutors::BinaryExecute<list_entry_t>(args, state, result, GetJSONBKeys);
+}
+
+static void ManyJSONBKeysFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONBinaryExecutors::ExecuteMany<list_entry_t>(args, state, result, GetJSONBKeys);
+}
+
 static void GetJSONKeysFunctionsInternal(ScalarFunctionSet &set, const LogicalType &input_type) {
 	set.AddFunction(ScalarFunction({input_type}, LogicalType::LIST(LogicalType::VARCHAR), UnaryJSONKeysFunction,
 	                               nullptr, nullptr, nullptr, JSONFunctionLocalState::Init));
@@ -53,6 +90,16 @@ ScalarFunctionSet JSONFunctions::GetKeysFunction() {
 	ScalarFunctionSet set("json_keys");
 	GetJSONKeysFunctionsInternal(set, LogicalType::VARCHAR);
 	GetJSONKeysFunctionsInternal(set, LogicalType::JSON());
+
+	const auto jsonb = JSONBinary::GetType();
+	set.AddFunction(ScalarFunction({jsonb}, LogicalType::LIST(LogicalType::VARCHAR), UnaryJSONBKeysFunction, nullptr,
+	                               nullptr, nullptr, JSONFunctionLocalState::Init));
+	set.AddFunction(ScalarFunction({jsonb, LogicalType::VARCHAR}, LogicalType::LIST(LogicalType::VARCHAR),
+	                               BinaryJSONBKeysFunction, JSONReadFunctionData::Bind, nullptr, nullptr,
+	                               JSONFunctionLocalState::Init));
+	set.AddFunction(ScalarFunction({jsonb, LogicalType::LIST(LogicalType::VARCHAR)},
+	                               LogicalType::LIST(LogicalType::LIST(LogicalType::VARCHAR)), ManyJSONBKeysFunction,
+	                               JSONReadManyFunctionData::Bind, nullptr, nullptr, JSONFunctionLocalState::Init));
 	return set;
 }
 
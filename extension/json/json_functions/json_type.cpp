@@ -6,6 +6,10 @@ static inline string_t GetType(yyjson_val *val, yyjson_alc *alc, Vector &result)
 	return JSONCommon::ValTypeToStringT(val);
 }
 
+static inline string_t GetJSONBType(const_data_ptr_t val, yyjson_alc *alc, Vector &result) {
+	return JSONBinary::ValTypeToStringT(val);
+}
+
 static void UnaryTypeFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	JSONExecutors::UnaryExecute<string_t>(args, state, result, GetType);
 }
@@ -18,6 +22,18 @@ static void ManyTypeFunction(DataChunk &args, ExpressionState &state, Vector &re
 	JSONExecutors::ExecuteMany<string_t>(args, state, result, GetType);
 }
 
+static void UnaryTypeJSONBFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONBinaryExecutors::UnaryExecute<string_t>(args, state, result, GetJSONBType);
+}
+
+static void BinaryTypeJSONBFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONBinaryExecutors::BinaryExecute<string_t>(args, state, result, GetJSONBType);
+}
+
+static void ManyTypeJSONBFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONBinaryExecutors::ExecuteMany<string_t>(args, state, result, GetJSONBType);
+}
+
 static void GetTypeFunctionsInternal(ScalarFunctionSet &set, const LogicalType &input_type) {
 	set.AddFunction(ScalarFunction({input_type}, LogicalType::VARCHAR, UnaryTypeFunction, nullptr, nullptr, nullptr,
 	                               JSONFunctionLocalState::Init));
@@ -32,6 +48,15 @@ ScalarFunctionSet JSONFunctions::GetTypeFunction() {
 	ScalarFunctionSet set("json_type");
 	GetTypeFunctionsInternal(set, LogicalType::VARCHAR);
 	GetTypeFunctionsInternal(set, LogicalType::JSON());
+
+	const auto jsonb = JSONBinary::GetType();
+	set.AddFunction(ScalarFunction({jsonb}, LogicalType::VARCHAR, UnaryTypeJSONBFunction, nullptr, nullptr, nullptr,
+	                               JSONFunctionLocalState::Init));
+	set.AddFunction(ScalarFunction({jsonb, LogicalType::VARCHAR}, LogicalType::VARCHAR, BinaryTypeJSONBFunction,
+	                               JSONReadFunctionData::Bind, nullptr, nullptr, JSONFunctionLocalState::Init));
+	set.AddFunction(ScalarFunction({jsonb, LogicalType::LIST(LogicalType::VARCHAR)},
+	                               LogicalType::LIST(LogicalType::VARCHAR), ManyTypeJSONBFunction,
+	                               JSONReadManyFunctionData::Bind, nullptr, nullptr, JSONFunctionLocalState::Init));
 	return set;
 }
 
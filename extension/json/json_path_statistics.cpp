@@ -0,0 +1,379 @@
+#include "json_path_statistics.hpp"
+
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/planner/expression/bound_cast_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/json_path_filter.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
+#include "json_functions.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Collector
+//===--------------------------------------------------------------------===//
+JSONPathStatisticsCollector::JSONPathEntry::JSONPathEntry(vector<string> path_p)
+    : path(std::move(path_p)), type(JSONPathValueType::NONE), count(0), has_integer(false), has_real(false),
+      integer_min(NumericLimits<int64_t>::Maximum()), integer_max(NumericLimits<int64_t>::Minimum()),
+      real_min(NumericLimits<double>::Maximum()), real_max(NumericLimits<double>::Minimum()),
+      string_stats(StringStats::CreateEmpty(LogicalType::VARCHAR)) {
+}
+
+BaseStatistics JSONPathStatisticsCollector::JSONPathEntry::GetStatistics() const {
+	D_ASSERT(type == JSONPathValueType::NUMERIC || type == JSONPathValueType::VARCHAR);
+	if (type == JSONPathValueType::VARCHAR) {
+		auto stats = string_stats.Copy();
+		// the path can be missing or NULL in any row
+		stats.SetHasNull();
+		stats.SetHasNoNull();
+		return stats;
+	}
+	auto stats = NumericStats::CreateEmpty(has_real ? LogicalType::DOUBLE : LogicalType::BIGINT);
+	if (!has_real) {
+		NumericStats::SetMin(stats, Value::BIGINT(integer_min));
+		NumericStats::SetMax(stats, Value::BIGINT(integer_max));
+	} else {
+		// integers and reals are both extracted as numbers, which can be cast to DOUBLE
+		auto min = real_min;
+		auto max = real_max;
+		if (has_integer) {
+			min = MinValue(min, static_cast<double>(integer_min));
+			max = MaxValue(max, static_cast<double>(integer_max));
+		}
+		NumericStats::SetMin(stats, Value::DOUBLE(min));
+		NumericStats::SetMax(stats, Value::DOUBLE(max));
+	}
+	// the path can be missing or NULL in any row
+	stats.SetHasNull();
+	stats.SetHasNoNull();
+	return stats;
+}
+
+JSONPathStatisticsCollector::JSONPathStatisticsCollector() : json_allocator(Allocator::DefaultAllocator()) {
+}
+
+unique_ptr<JSONPathStatisticsAnalyzer> JSONPathStatisticsCollector::Create() {
+	return make_uniq<JSONPathStatisticsCollector>();
+}
+
+bool JSONPathStatisticsCollector::Analyze(Vector &input, idx_t count) {
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	auto strings = UnifiedVectorFormat::GetData<string_t>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		auto doc = JSONCommon::ReadDocumentUnsafe(strings[idx], JSONCommon::READ_FLAG, json_allocator.GetYYAlc());
+		if (!doc || !yyjson_is_obj(doc->root)) {
+			// the paths of a column with arrays or scalars at the root could be extracted by array index
+			json_allocator.Reset();
+			return false;
+		}
+		path_buffer.clear();
+		path_keys.clear();
+		AnalyzeObject(doc->root, 0);
+	}
+	json_allocator.Reset();
+	return true;
+}
+
+optional_ptr<JSONPathStatisticsCollector::JSONPathEntry> JSONPathStatisticsCollector::GetEntry(idx_t depth) {
+	auto entry = entry_map.find(path_buffer);
+	if (entry != entry_map.end()) {
+		return &entries[entry->second];
+	}
+	if (entries.size() == MAX_TRACKED_PATHS) {
+		return nullptr;
+	}
+	entry_map.emplace(path_buffer, entries.size());
+	entries.emplace_back(vector<string>(path_keys.begin(), path_keys.begin() + NumericCast<int64_t>(depth)));
+	return &entries.back();
+}
+
+void JSONPathStatisticsCollector::AnalyzeObject(yyjson_val *obj, idx_t depth) {
+	const auto buffer_size = path_buffer.size();
+	size_t idx, max;
+	yyjson_val *key, *val;
+	yyjson_obj_foreach(obj, idx, max, key, val) {
+		// the keys are prefixed with their length, so the paths of different keys cannot collide
+		const auto key_len = unsafe_yyjson_get_len(key);
+		path_buffer.resize(buffer_size);
+		path_buffer += to_string(key_len);
+		path_buffer += ':';
+		path_buffer.append(unsafe_yyjson_get_str(key), key_len);
+		if (path_keys.size() <= depth) {
+			path_keys.emplace_back();
+		}
+		path_keys[depth].assign(unsafe_yyjson_get_str(key), key_len);
+
+		if (yyjson_is_null(val)) {
+			continue; // NULL values are skipped, they are extracted as NULL
+		}
+		auto entry = GetEntry(depth + 1);
+		if (yyjson_is_arr(val)) {
+			if (array_paths.insert(path_buffer).second) {
+				array_path_keys.emplace_back(path_keys.begin(), path_keys.begin() + NumericCast<int64_t>(depth + 1));
+			}
+		}
+		if (entry) {
+			AnalyzeValue(*entry, val);
+		}
+		if (yyjson_is_obj(val) && depth + 1 < MAX_DEPTH) {
+			AnalyzeObject(val, depth + 1);
+		}
+	}
+	path_buffer.resize(buffer_size);
+}
+
+void JSONPathStatisticsCollector::AnalyzeValue(JSONPathEntry &entry, yyjson_val *val) {
+	if (entry.type == JSONPathValueType::INVALID) {
+		return;
+	}
+	JSONPathValueType type;
+	switch (yyjson_get_tag(val)) {
+	case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_UINT: {
+		const auto value = unsafe_yyjson_get_uint(val);
+		if (value > static_cast<uint64_t>(NumericLimits<int64_t>::Maximum())) {
+			type = JSONPathValueType::INVALID;
+			break;
+		}
+		type = JSONPathValueType::NUMERIC;
+		entry.has_integer = true;
+		entry.integer_min = MinValue(entry.integer_min, static_cast<int64_t>(value));
+		entry.integer_max = MaxValue(entry.integer_max, static_cast<int64_t>(value));
+		break;
+	}
+	case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_SINT: {
+		const auto value = unsafe_yyjson_get_sint(val);
+		type = JSONPathValueType::NUMERIC;
+		entry.has_integer = true;
+		entry.integer_min = MinValue(entry.integer_min, value);
+		entry.integer_max = MaxValue(entry.integer_max, value);
+		break;
+	}
+	case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_REAL: {
+		const auto value = unsafe_yyjson_get_real(val);
+		if (!Value::IsFinite(value)) {
+			type = JSONPathValueType::INVALID;
+			break;
+		}
+		type = JSONPathValueType::NUMERIC;
+		entry.has_real = true;
+		entry.real_min = MinValue(entry.real_min, value);
+		entry.real_max = MaxValue(entry.real_max, value);
+		break;
+	}
+	case YYJSON_TYPE_STR | YYJSON_SUBTYPE_NONE:
+		type = JSONPathValueType::VARCHAR;
+		StringStats::Update(entry.string_stats, string_t(unsafe_yyjson_get_str(val),
+		                                                 UnsafeNumericCast<uint32_t>(unsafe_yyjson_get_len(val))));
+		break;
+	default:
+		// booleans, arrays and objects are not tracked
+		type = JSONPathValueType::INVALID;
+		break;
+	}
+	if (entry.type != JSONPathValueType::NONE && entry.type != type) {
+		type = JSONPathValueType::INVALID;
+	}
+	entry.type = type;
+	entry.count++;
+}
+
+bool JSONPathStatisticsCollector::IsArrayDescendant(const vector<string> &path) const {
+	for (auto &array_path : array_path_keys) {
+		if (array_path.size() < path.size() && std::equal(array_path.begin(), array_path.end(), path.begin())) {
+			return true;
+		}
+	}
+	return false;
+}
+
+vector<JSONPathStatistics> JSONPathStatisticsCollector::Finalize() {
+	vector<reference<JSONPathEntry>> candidates;
+	for (auto &entry : entries) {
+		if (entry.type == JSONPathValueType::NONE || entry.type == JSONPathValueType::INVALID) {
+			continue;
+		}
+		if (IsArrayDescendant(entry.path)) {
+			continue;
+		}
+		candidates.push_back(entry);
+	}
+	std::stable_sort(candidates.begin(), candidates.end(),
+	                 [](const JSONPathEntry &lhs, const JSONPathEntry &rhs) { return lhs.count > rhs.count; });
+	if (candidates.size() > MAX_PATH_STATISTICS) {
+		candidates.erase(candidates.begin() + MAX_PATH_STATISTICS, candidates.end());
+	}
+
+	vector<JSONPathStatistics> result;
+	for (auto &candidate : candidates) {
+		auto &entry = candidate.get();
+		result.emplace_back(entry.path, entry.GetStatistics());
+	}
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// Optimizer
+//===--------------------------------------------------------------------===//
+static const case_insensitive_set_t JSON_EXTRACT_STRING_FUNCTION_NAMES {"->>", "json_extract_string",
+                                                                        "json_extract_path_text"};
+
+//! Parses the keys of a JSON path ($.a."b") or pointer (/a/b), returns false for other paths
+static bool ParseJSONPathKeys(const string &path, vector<string> &keys) {
+	if (path.empty()) {
+		return false;
+	}
+	const char *ptr = path.c_str();
+	const char *const end = ptr + path.size();
+	if (*ptr == '/') {
+		for (ptr++;; ptr++) {
+			string key;
+			for (; ptr != end && *ptr != '/'; ptr++) {
+				if (*ptr != '~') {
+					key += *ptr;
+					continue;
+				}
+				// '~0' and '~1' are the escapes of '~' and '/'
+				if (ptr + 1 == end || (ptr[1] != '0' && ptr[1] != '1')) {
+					return false;
+				}
+				ptr++;
+				key += *ptr == '0' ? '~' : '/';
+			}
+			keys.push_back(std::move(key));
+			if (ptr == end) {
+				return true;
+			}
+		}
+	}
+	if (*ptr != '$') {
+		return false;
+	}
+	ptr++;
+	while (ptr != end) {
+		if (*ptr++ != '.' || ptr == end) {
+			return false;
+		}
+		const char *key_ptr;
+		idx_t key_len;
+		if (!JSONCommon::ReadKey(ptr, end, key_ptr, key_len) || key_len == DConstants::INVALID_INDEX) {
+			return false;
+		}
+		keys.emplace_back(key_ptr, key_len);
+	}
+	return !keys.empty();
+}
+
+//! Matches an extraction of a path as text from a JSON column (optionally cast to a numeric type)
+static bool MatchJSONPathExtraction(const Expression &expr, ColumnBinding &binding, vector<string> &keys) {
+	reference<const Expression> extraction(expr);
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_CAST) {
+		auto &cast_type = expr.return_type;
+		if (!cast_type.IsIntegral() && cast_type.id() != LogicalTypeId::DOUBLE) {
+			return false;
+		}
+		extraction = *expr.Cast<BoundCastExpression>().child;
+	}
+	if (extraction.get().GetExpressionClass() != ExpressionClass::BOUND_FUNCTION ||
+	    extraction.get().return_type != LogicalType::VARCHAR) {
+		return false;
+	}
+	auto &func_expr = extraction.get().Cast<BoundFunctionExpression>();
+	if (JSON_EXTRACT_STRING_FUNCTION_NAMES.count(func_expr.function.name) == 0 || func_expr.children.size() != 2 ||
+	    !func_expr.bind_info) {
+		return false;
+	}
+	auto &input = *func_expr.children[0];
+	if (input.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF || !input.return_type.IsJSONType()) {
+		return false;
+	}
+	auto &bind_data = func_expr.bind_info->Cast<JSONReadFunctionData>();
+	if (!bind_data.constant || bind_data.path_type != JSONCommon::JSONPathType::REGULAR) {
+		return false;
+	}
+	binding = input.Cast<BoundColumnRefExpression>().binding;
+	return ParseJSONPathKeys(bind_data.path, keys);
+}
+
+static void PushJSONPathFilter(LogicalGet &get, Expression &expr) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_COMPARISON) {
+		return;
+	}
+	auto &comparison = expr.Cast<BoundComparisonExpression>();
+	auto comparison_type = comparison.type;
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+	case ExpressionType::COMPARE_LESSTHAN:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		break;
+	default:
+		return;
+	}
+	reference<Expression> extraction = *comparison.left;
+	reference<Expression> constant = *comparison.right;
+	if (extraction.get().GetExpressionClass() == ExpressionClass::BOUND_CONSTANT) {
+		std::swap(extraction, constant);
+		comparison_type = FlipComparisonExpression(comparison_type);
+	}
+	if (constant.get().GetExpressionClass() != ExpressionClass::BOUND_CONSTANT) {
+		return;
+	}
+	auto &value = constant.get().Cast<BoundConstantExpression>().value;
+	if (value.IsNull()) {
+		return;
+	}
+	ColumnBinding binding;
+	vector<string> keys;
+	if (!MatchJSONPathExtraction(extraction, binding, keys) || binding.table_index != get.table_index) {
+		return;
+	}
+	auto column_index = get.column_ids[binding.column_index];
+	if (column_index == COLUMN_IDENTIFIER_ROW_ID) {
+		return;
+	}
+	auto child_filter = make_uniq<ConstantFilter>(comparison_type, value);
+	get.table_filters.PushFilter(column_index, make_uniq<JSONPathFilter>(std::move(keys), std::move(child_filter)));
+}
+
+static void OptimizeRecursive(LogicalOperator &op) {
+	for (auto &child : op.children) {
+		OptimizeRecursive(*child);
+	}
+	if (op.type != LogicalOperatorType::LOGICAL_FILTER ||
+	    op.children[0]->type != LogicalOperatorType::LOGICAL_GET) {
+		return;
+	}
+	auto &get = op.children[0]->Cast<LogicalGet>();
+	if (get.function.name != "seq_scan" || !get.bind_data || get.bind_data->Cast<TableScanBindData>().is_index_scan) {
+		return;
+	}
+	for (auto &expr : op.expressions) {
+		PushJSONPathFilter(get, *expr);
+	}
+}
+
+void JSONPathFilterOptimizer::Optimize(ClientContext &context, OptimizerExtensionInfo *info,
+                                       unique_ptr<LogicalOperator> &plan) {
+	OptimizeRecursive(*plan);
+}
+
+OptimizerExtension JSONPathFilterOptimizer::GetOptimizerExtension() {
+	OptimizerExtension extension;
+	extension.optimize_function = Optimize;
+	return extension;
+}
+
+} // namespace duckdb
@@ -7,6 +7,7 @@
 #include "duckdb/main/extension_helper.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "json_structural_index.hpp"
 
 namespace duckdb {
 
@@ -139,14 +140,15 @@ string JSONScanData::GetTimestampFormat() const {
 JSONScanGlobalState::JSONScanGlobalState(ClientContext &context, const JSONScanData &bind_data_p)
     : bind_data(bind_data_p), transform_options(bind_data.transform_options),
       allocator(BufferManager::GetBufferManager(context).GetBufferAllocator()),
-      buffer_capacity(bind_data.maximum_object_size * 2), file_index(0), batch_index(0),
+      project_records(false), buffer_capacity(bind_data.maximum_object_size * 2), file_index(0), batch_index(0),
       system_threads(TaskScheduler::GetScheduler(context).NumberOfThreads()),
       enable_parallel_scans(bind_data.files.size() < system_threads) {
 }
 
 JSONScanLocalState::JSONScanLocalState(ClientContext &context, JSONScanGlobalState &gstate)
     : scan_count(0), batch_index(DConstants::INVALID_INDEX), total_read_size(0), total_tuple_count(0),
-      bind_data(gstate.bind_data), allocator(BufferAllocator::Get(context)), is_last(false),
+      bind_data(gstate.bind_data), allocator(BufferAllocator::Get(context)),
+      projected_keys(gstate.project_records ? &gstate.projected_keys : nullptr), is_last(false),
       fs(FileSystem::GetFileSystem(context)), buffer_size(0), buffer_offset(0), prev_buffer_remainder(0) {
 }
 
@@ -189,6 +191,15 @@ unique_ptr<GlobalTableFunctionState> JSONGlobalTableFunctionState::Init(ClientCo
 		gstate.transform_options.error_unknown_key = false;
 	}
 
+	if (bind_data.type == JSONScanType::READ_JSON && bind_data.options.record_type == JSONRecordType::RECORDS &&
+	    gstate.names.size() < bind_data.names.size()) {
+		// We don't need all columns, so we can skip over the members of the records that we don't need
+		gstate.project_records = true;
+		for (const auto &name : gstate.names) {
+			gstate.projected_keys.insert({name.c_str(), name.length()});
+		}
+	}
+
 	// Place readers where they belong
 	if (bind_data.initial_reader) {
 		bind_data.initial_reader->Reset();
@@ -299,51 +310,19 @@ static inline const char *PreviousNewline(const char *ptr, const idx_t size) {
 	return ptr;
 }
 
-static inline const char *NextJSONDefault(const char *ptr, const char *const end) {
-	idx_t parents = 0;
-	while (ptr != end) {
-		switch (*ptr++) {
-		case '{':
-		case '[':
-			parents++;
-			continue;
-		case '}':
-		case ']':
-			parents--;
-			break;
-		case '"':
-			while (ptr != end) {
-				auto string_char = *ptr++;
-				if (string_char == '"') {
-					break;
-				} else if (string_char == '\\') {
-					if (ptr != end) {
-						ptr++; // Skip the escaped char
-					}
-				}
-			}
-			break;
-		default:
-			continue;
-		}
-
-		if (parents == 0) {
-			break;
-		}
-	}
-
-	return ptr;
-}
-
-static inline const char *NextJSON(const char *ptr, const idx_t size) {
+static inline const char *NextJSON(JSONStructuralIndex &index, const char *const buffer_ptr, const idx_t offset,
+                                   const idx_t size) {
+	auto ptr = buffer_ptr + offset;
 	D_ASSERT(!StringUtil::CharacterIsSpace(*ptr)); // Should be handled before
 
 	const char *const end = ptr + size;
 	switch (*ptr) {
 	case '{':
 	case '[':
+		ptr = buffer_ptr + index.SkipContainer(offset, offset + size);
+		break;
 	case '"':
-		ptr = NextJSONDefault(ptr, end);
+		ptr = buffer_ptr + JSONStructuralIndex::SkipString(buffer_ptr, offset, offset + size);
 		break;
 	default:
 		// Special case: JSON array containing JSON without clear "parents", i.e., not obj/arr/str
@@ -374,6 +353,10 @@ static inline void TrimWhitespace(JSONString &line) {
 }
 
 void JSONScanLocalState::ParseJSON(char *const json_start, const idx_t json_size, const idx_t remaining) {
+	if (projected_keys && ParseProjectedJSON(json_start, json_size, remaining)) {
+		return;
+	}
+
 	yyjson_doc *doc;
 	yyjson_read_err err;
 	if (bind_data.type == JSONScanType::READ_JSON_OBJECTS) { // If we return strings, we cannot parse INSITU
@@ -421,6 +404,122 @@ void JSONScanLocalState::ParseJSON(char *const json_start, const idx_t json_size
 	values[scan_count] = doc->root;
 }
 
+static inline bool TrimMember(const char *const json_start, idx_t &begin, idx_t &end) {
+	while (begin != end && StringUtil::CharacterIsSpace(json_start[begin])) {
+		begin++;
+	}
+	while (begin != end && StringUtil::CharacterIsSpace(json_start[end - 1])) {
+		end--;
+	}
+	return begin != end;
+}
+
+bool JSONScanLocalState::ParseProjectedJSON(char *const json_start, const idx_t json_size, const idx_t remaining) {
+	// Copy the members with a projected key into a new object, and skip over the others without parsing them
+	// Anything that is not a well-formed object is left to ParseJSON, which also takes care of reporting errors
+	idx_t pos = 0;
+	SkipWhitespace(json_start, pos, json_size);
+	if (pos == json_size || json_start[pos] != '{') {
+		return false;
+	}
+
+	auto projected = JSONCommon::AllocateArray<char>(allocator.GetYYAlc(), json_size + YYJSON_PADDING_SIZE);
+	idx_t projected_size = 0;
+	projected[projected_size++] = '{';
+
+	// The members of the object are delimited by the commas and the closing brace that are at depth 1
+	// Below that, we only have to keep track of the depth, so we only look at the braces and brackets
+	JSONStructuralIndex index(json_start, remaining);
+	index.Reset(pos);
+	idx_t depth = 0;
+	uint64_t object_mask = 0; // One bit per level, which is set if it is an object rather than an array
+	idx_t member_start = pos + 1;
+	idx_t colon = DConstants::INVALID_INDEX;
+	while (true) {
+		pos = depth == 1 ? index.Next(json_size) : index.NextBracket(json_size);
+		if (pos == json_size) {
+			return false;
+		}
+		const auto c = json_start[pos];
+		if (c == '{' || c == '[') {
+			if (depth == sizeof(object_mask) * 8) {
+				return false; // Records that are nested this deeply are parsed as usual
+			}
+			object_mask = (object_mask << 1) | (c == '{');
+			depth++;
+			continue;
+		}
+		if (c == '}' || c == ']') {
+			if ((object_mask & 1) != (c == '}')) {
+				return false;
+			}
+			object_mask >>= 1;
+			if (--depth != 0) {
+				continue;
+			}
+		} else if (c == ':') {
+			if (colon != DConstants::INVALID_INDEX) {
+				return false;
+			}
+			colon = pos;
+			continue;
+		}
+
+		// Reached the end of a member, which can only be empty if it is the last one (empty object / trailing comma)
+		idx_t key_start = member_start;
+		idx_t key_end = colon;
+		member_start = pos + 1;
+		if (colon == DConstants::INVALID_INDEX) {
+			idx_t member_end = pos;
+			if (c == '}' && !TrimMember(json_start, key_start, member_end)) {
+				break;
+			}
+			return false;
+		}
+		colon = DConstants::INVALID_INDEX;
+
+		idx_t value_start = key_end + 1;
+		idx_t value_end = pos;
+		if (!TrimMember(json_start, key_start, key_end) || !TrimMember(json_start, value_start, value_end) ||
+		    key_end - key_start < 2 || json_start[key_start] != '"' || json_start[key_end - 1] != '"') {
+			return false;
+		}
+
+		// Keys with escapes are always copied, as they can only be compared after unescaping them
+		const JSONKey key {json_start + key_start + 1, key_end - key_start - 2};
+		if (memchr(key.ptr, '\\', key.len) || projected_keys->find(key) != projected_keys->end()) {
+			if (projected_size != 1) {
+				projected[projected_size++] = ',';
+			}
+			memcpy(projected + projected_size, json_start + key_start, value_end - key_start);
+			projected_size += value_end - key_start;
+		}
+		if (c != ',') {
+			break;
+		}
+	}
+	pos++;
+	SkipWhitespace(json_start, pos, json_size);
+	if (pos != json_size) {
+		return false;
+	}
+	projected[projected_size++] = '}';
+	memset(projected + projected_size, 0, YYJSON_PADDING_SIZE);
+
+	yyjson_read_err err;
+	auto doc = JSONCommon::ReadDocumentUnsafe(projected, projected_size, JSONCommon::READ_INSITU_FLAG,
+	                                          allocator.GetYYAlc(), &err);
+	if (err.code != YYJSON_READ_SUCCESS) {
+		return false;
+	}
+
+	lines_or_objects_in_buffer++;
+	units[scan_count] = JSONString(json_start, json_size);
+	TrimWhitespace(units[scan_count]);
+	values[scan_count] = doc->root;
+	return true;
+}
+
 void JSONScanLocalState::ThrowObjectSizeError(const idx_t object_size) {
 	throw InvalidInputException(
 	    "\"maximum_object_size\" of %llu bytes exceeded while reading file \"%s\" (>%llu bytes)."
@@ -879,6 +978,7 @@ void JSONScanLocalState::ParseNextChunk(JSONScanGlobalState &gstate) {
 
 	const auto format = current_reader->GetFormat();
 	D_ASSERT(format != JSONFormat::AUTO_DETECT);
+	JSONStructuralIndex index(buffer_ptr, buffer_size);
 	for (; scan_count < STANDARD_VECTOR_SIZE; scan_count++) {
 		SkipWhitespace(buffer_ptr, buffer_offset, buffer_size);
 		auto json_start = buffer_ptr + buffer_offset;
@@ -886,8 +986,9 @@ void JSONScanLocalState::ParseNextChunk(JSONScanGlobalState &gstate) {
 		if (remaining == 0) {
 			break;
 		}
-		const char *json_end = format == JSONFormat::NEWLINE_DELIMITED ? NextNewline(json_start, remaining)
-		                                                               : NextJSON(json_start, remaining);
+		const char *json_end = format == JSONFormat::NEWLINE_DELIMITED
+		                           ? NextNewline(json_start, remaining)
+		                           : NextJSON(index, buffer_ptr, buffer_offset, remaining);
 		if (json_end == nullptr) {
 			// We reached the end of the buffer
 			if (!is_last) {
@@ -21,6 +21,7 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/types/bit.hpp"
 #include "duckdb/common/types/blob.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #endif
 
 namespace duckdb {
@@ -143,10 +144,28 @@ idx_t ColumnReader::MaxRepeat() const {
 }
 
 void ColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) {
-	if (chunk) {
-		uint64_t size = chunk->meta_data.total_compressed_size;
-		transport.RegisterPrefetch(FileOffset(), size, allow_merge);
+	if (!chunk) {
+		return;
 	}
+	if (std::find(pruned_pages.begin(), pruned_pages.end(), true) != pruned_pages.end()) {
+		// only register the dictionary and the pages that are not pruned
+		auto start_offset = FileOffset();
+		auto first_page_offset = NumericCast<idx_t>(page_locations[0].offset);
+		if (first_page_offset > start_offset) {
+			transport.RegisterPrefetch(start_offset, first_page_offset - start_offset, allow_merge);
+		}
+		for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+			if (pruned_pages[page_idx]) {
+				continue;
+			}
+			auto &page_location = page_locations[page_idx];
+			transport.RegisterPrefetch(NumericCast<idx_t>(page_location.offset),
+			                           NumericCast<idx_t>(page_location.compressed_page_size), allow_merge);
+		}
+		return;
+	}
+	uint64_t size = chunk->meta_data.total_compressed_size;
+	transport.RegisterPrefetch(FileOffset(), size, allow_merge);
 }
 
 uint64_t ColumnReader::TotalCompressedSize() {
@@ -184,6 +203,35 @@ unique_ptr<BaseStatistics> ColumnReader::Stats(idx_t row_group_idx_p, const vect
 	return ParquetStatisticsUtils::TransformColumnStatistics(*this, columns);
 }
 
+bool ColumnReader::CanUsePageIndex() const {
+	// readers that wrap other readers (e.g. casts, structs, lists) never set the chunk themselves
+	return chunk && max_repeat == 0;
+}
+
+void ColumnReader::SetPageIndex(vector<PageLocation> page_locations_p,
+                                const vector<pair<idx_t, idx_t>> &pruned_ranges) {
+	D_ASSERT(CanUsePageIndex());
+	page_locations = std::move(page_locations_p);
+	pruned_pages.clear();
+	if (page_locations.empty()) {
+		return;
+	}
+	auto num_rows = NumericCast<idx_t>(chunk->meta_data.num_values);
+	idx_t range_idx = 0;
+	for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+		auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+		auto page_end = page_idx + 1 < page_locations.size()
+		                    ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+		                    : num_rows;
+		while (range_idx < pruned_ranges.size() && pruned_ranges[range_idx].second <= page_start) {
+			range_idx++;
+		}
+		bool pruned = range_idx < pruned_ranges.size() && pruned_ranges[range_idx].first <= page_start &&
+		              pruned_ranges[range_idx].second >= page_end;
+		pruned_pages.push_back(pruned);
+	}
+}
+
 void ColumnReader::Plain(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, idx_t num_values, // NOLINT
                          parquet_filter_t &filter, idx_t result_offset, Vector &result) {
 	throw NotImplementedException("Plain");
@@ -234,6 +282,11 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 		chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 	}
 	group_rows_available = chunk->meta_data.num_values;
+	// skips that were not applied yet belong to the previous column chunk
+	pending_skips = 0;
+	page_rows_available = 0;
+	page_locations.clear();
+	pruned_pages.clear();
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
@@ -593,7 +646,20 @@ void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	idx_t read = 0;
 
 	while (remaining) {
+		if (page_rows_available == 0) {
+			// we are at a page boundary: jump over any pages we skip entirely
+			auto skipped = SkipPages(remaining);
+			read += skipped;
+			remaining -= skipped;
+			if (remaining == 0) {
+				break;
+			}
+		}
 		idx_t to_read = MinValue<idx_t>(remaining, STANDARD_VECTOR_SIZE);
+		if (!page_locations.empty() && page_rows_available > 0) {
+			// stop at the end of the current page, so we can jump over the pages that follow it
+			to_read = MinValue<idx_t>(to_read, page_rows_available);
+		}
 		read += Read(to_read, none_filter, dummy_define.ptr, dummy_repeat.ptr, dummy_result);
 		remaining -= to_read;
 	}
@@ -603,6 +669,39 @@ void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	}
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (page_locations.empty()) {
+		return 0;
+	}
+	D_ASSERT(page_rows_available == 0);
+	auto current_row = NumericCast<idx_t>(chunk->meta_data.num_values) - group_rows_available;
+	auto target_row = current_row + num_values;
+	// find the last page that starts at or before the target row
+	idx_t page_idx = 0;
+	while (page_idx + 1 < page_locations.size() &&
+	       NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index) <= target_row) {
+		page_idx++;
+	}
+	auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+	if (page_start <= current_row) {
+		// the target row is in the next page - nothing to jump over
+		return 0;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	if (chunk->meta_data.__isset.dictionary_page_offset &&
+	    chunk_read_offset < NumericCast<idx_t>(page_locations[0].offset)) {
+		// we have not read the dictionary page yet, which the pages after the jump might need
+		trans.SetLocation(chunk_read_offset);
+		PrepareRead(none_filter);
+		page_rows_available = 0;
+	}
+	chunk_read_offset = NumericCast<idx_t>(page_locations[page_idx].offset);
+	trans.SetLocation(chunk_read_offset);
+	auto skipped = page_start - current_row;
+	group_rows_available -= skipped;
+	return skipped;
+}
+
 //===--------------------------------------------------------------------===//
 // String Column Reader
 //===--------------------------------------------------------------------===//
@@ -806,10 +905,17 @@ idx_t ListColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data
 	}
 
 	D_ASSERT(ListVector::GetListSize(result_out) == 0);
+	if (primitive_child) {
+		// reserve the child list size of the previous reads up front, instead of growing the child vector per read
+		ListVector::Reserve(result_out, child_capacity_hint);
+	}
 	// if an individual list is longer than STANDARD_VECTOR_SIZE we actually have to loop the child read to fill it
 	bool finished = false;
 	while (!finished) {
 		idx_t child_actual_num_values = 0;
+		idx_t current_chunk_offset = ListVector::GetListSize(result_out);
+		// if set, the child values were read straight into the child vector of the result, through this view on it
+		unique_ptr<Vector> child_view;
 
 		// check if we have any overflow from a previous read
 		if (overflow_child_count == 0) {
@@ -822,9 +928,21 @@ idx_t ListColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data
 			// if we have read enough, we leave any unhandled elements in the overflow vector for a subsequent read
 			auto child_req_num_values =
 			    MinValue<idx_t>(STANDARD_VECTOR_SIZE, child_column_reader->GroupRowsAvailable());
-			read_vector.ResetFromCache(read_cache);
-			child_actual_num_values = child_column_reader->Read(child_req_num_values, child_filter, child_defines_ptr,
-			                                                    child_repeats_ptr, read_vector);
+			if (primitive_child) {
+				// primitive values are read into the child vector of the result at its current size, which saves
+				// copying them into it afterwards
+				ListVector::Reserve(result_out, current_chunk_offset + child_req_num_values);
+				auto &list_child = ListVector::GetEntry(result_out);
+				auto type_size = GetTypeIdSize(list_child.GetType().InternalType());
+				child_view = make_uniq<Vector>(list_child.GetType(),
+				                               FlatVector::GetData(list_child) + current_chunk_offset * type_size);
+				child_actual_num_values = child_column_reader->Read(child_req_num_values, child_filter,
+				                                                    child_defines_ptr, child_repeats_ptr, *child_view);
+			} else {
+				read_vector.ResetFromCache(read_cache);
+				child_actual_num_values = child_column_reader->Read(child_req_num_values, child_filter,
+				                                                    child_defines_ptr, child_repeats_ptr, read_vector);
+			}
 		} else {
 			// we do: use the overflow values
 			child_actual_num_values = overflow_child_count;
@@ -835,18 +953,22 @@ idx_t ListColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data
 			// no more elements available: we are done
 			break;
 		}
-		read_vector.Verify(child_actual_num_values);
-		idx_t current_chunk_offset = ListVector::GetListSize(result_out);
+		auto &child_vector = child_view ? *child_view : read_vector;
+		child_vector.Verify(child_actual_num_values);
 
 		// hard-won piece of code this, modify at your own risk
 		// the intuition is that we have to only collapse values into lists that are repeated *on this level*
 		// the rest is pretty much handed up as-is as a single-valued list or NULL
-		idx_t child_idx;
-		for (child_idx = 0; child_idx < child_actual_num_values; child_idx++) {
+		idx_t child_idx = 0;
+		while (child_idx < child_actual_num_values) {
 			if (child_repeats_ptr[child_idx] == max_repeat) {
-				// value repeats on this level, append
+				// values repeat on this level: append the whole run of them to the current list at once
 				D_ASSERT(result_offset > 0);
-				result_ptr[result_offset - 1].length++;
+				auto run_start = child_idx;
+				do {
+					child_idx++;
+				} while (child_idx < child_actual_num_values && child_repeats_ptr[child_idx] == max_repeat);
+				result_ptr[result_offset - 1].length += child_idx - run_start;
 				continue;
 			}
 
@@ -874,14 +996,38 @@ idx_t ListColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data
 			define_out[result_offset] = child_defines_ptr[child_idx];
 
 			result_offset++;
+			child_idx++;
+		}
+		if (child_view) {
+			// the required elements are already in the child list, only their validity and strings have to be added
+			auto &list_child = ListVector::GetEntry(result_out);
+			auto &view_validity = FlatVector::Validity(*child_view);
+			if (!view_validity.AllValid()) {
+				auto &list_child_validity = FlatVector::Validity(list_child);
+				for (idx_t i = 0; i < child_idx; i++) {
+					if (!view_validity.RowIsValid(i)) {
+						list_child_validity.SetInvalid(current_chunk_offset + i);
+					}
+				}
+			}
+			if (list_child.GetType().InternalType() == PhysicalType::VARCHAR) {
+				StringVector::AddHeapReference(list_child, *child_view);
+			}
+			ListVector::SetListSize(result_out, current_chunk_offset + child_idx);
+		} else {
+			// actually append the required elements to the child list
+			ListVector::Append(result_out, read_vector, child_idx);
 		}
-		// actually append the required elements to the child list
-		ListVector::Append(result_out, read_vector, child_idx);
 
 		// we have read more values from the child reader than we can fit into the result for this read
 		// we have to pass everything from child_idx to child_actual_num_values into the next call
 		if (child_idx < child_actual_num_values && result_offset == num_values) {
-			read_vector.Slice(read_vector, child_idx, child_actual_num_values);
+			if (child_view) {
+				read_vector.ResetFromCache(read_cache);
+				VectorOperations::Copy(*child_view, read_vector, child_actual_num_values, child_idx, 0);
+			} else {
+				read_vector.Slice(read_vector, child_idx, child_actual_num_values);
+			}
 			overflow_child_count = child_actual_num_values - child_idx;
 			read_vector.Verify(overflow_child_count);
 
@@ -892,6 +1038,7 @@ idx_t ListColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, data
 			}
 		}
 	}
+	child_capacity_hint = MaxValue<idx_t>(child_capacity_hint, ListVector::GetListSize(result_out));
 	result_out.Verify(result_offset);
 	return result_offset;
 }
@@ -901,7 +1048,11 @@ ListColumnReader::ListColumnReader(ParquetReader &reader, LogicalType type_p, co
                                    unique_ptr<ColumnReader> child_column_reader_p)
     : ColumnReader(reader, std::move(type_p), schema_p, schema_idx_p, max_define_p, max_repeat_p),
       child_column_reader(std::move(child_column_reader_p)),
-      read_cache(reader.allocator, ListType::GetChildType(Type())), read_vector(read_cache), overflow_child_count(0) {
+      read_cache(reader.allocator, ListType::GetChildType(Type())), read_vector(read_cache), overflow_child_count(0),
+      child_capacity_hint(STANDARD_VECTOR_SIZE) {
+	auto child_physical_type = ListType::GetChildType(Type()).InternalType();
+	primitive_child = child_physical_type != PhysicalType::LIST && child_physical_type != PhysicalType::STRUCT &&
+	                  child_physical_type != PhysicalType::ARRAY;
 
 	child_defines.resize(reader.allocator, STANDARD_VECTOR_SIZE);
 	child_repeats.resize(reader.allocator, STANDARD_VECTOR_SIZE);
@@ -1057,10 +1208,42 @@ ColumnReader *StructColumnReader::GetChildReader(idx_t child_idx) {
 	return child_readers[child_idx].get();
 }
 
+void ParquetStructProjection::AddPath(const vector<idx_t> &path, idx_t depth) {
+	if (all_fields) {
+		return;
+	}
+	if (depth == path.size()) {
+		all_fields = true;
+		fields.clear();
+		return;
+	}
+	fields[path[depth]].AddPath(path, depth + 1);
+}
+
+void StructColumnReader::ApplyProjection(const ParquetStructProjection &projection) {
+	if (projection.all_fields || projection.fields.empty()) {
+		return;
+	}
+	read_children = vector<bool>(child_readers.size(), false);
+	for (auto &entry : projection.fields) {
+		auto child_idx = entry.first;
+		if (child_idx >= child_readers.size()) {
+			throw InternalException("Parquet struct projection field index out of range");
+		}
+		read_children[child_idx] = true;
+		auto &child_reader = *child_readers[child_idx];
+		if (child_reader.Type().id() == LogicalTypeId::STRUCT) {
+			child_reader.Cast<StructColumnReader>().ApplyProjection(entry.second);
+		}
+	}
+}
+
 void StructColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns,
                                         TProtocol &protocol_p) {
-	for (auto &child : child_readers) {
-		child->InitializeRead(row_group_idx_p, columns, protocol_p);
+	for (idx_t i = 0; i < child_readers.size(); i++) {
+		if (ReadsChild(i)) {
+			child_readers[i]->InitializeRead(row_group_idx_p, columns, protocol_p);
+		}
 	}
 }
 
@@ -1073,42 +1256,57 @@ idx_t StructColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, da
 		ApplyPendingSkips(pending_skips);
 	}
 
-	idx_t read_count = num_values;
+	optional_idx read_count;
 	for (idx_t i = 0; i < struct_entries.size(); i++) {
+		if (!ReadsChild(i)) {
+			// the field is not used: emit NULL
+			struct_entries[i]->SetVectorType(VectorType::CONSTANT_VECTOR);
+			ConstantVector::SetNull(*struct_entries[i], true);
+			continue;
+		}
 		auto child_num_values = child_readers[i]->Read(num_values, filter, define_out, repeat_out, *struct_entries[i]);
-		if (i == 0) {
+		if (!read_count.IsValid()) {
 			read_count = child_num_values;
-		} else if (read_count != child_num_values) {
+		} else if (read_count.GetIndex() != child_num_values) {
 			throw std::runtime_error("Struct child row count mismatch");
 		}
 	}
+	if (!read_count.IsValid()) {
+		read_count = num_values;
+	}
 	// set the validity mask for this level
 	auto &validity = FlatVector::Validity(result);
-	for (idx_t i = 0; i < read_count; i++) {
+	for (idx_t i = 0; i < read_count.GetIndex(); i++) {
 		if (define_out[i] < max_define) {
 			validity.SetInvalid(i);
 		}
 	}
 
-	return read_count;
+	return read_count.GetIndex();
 }
 
 void StructColumnReader::Skip(idx_t num_values) {
-	for (auto &child_reader : child_readers) {
-		child_reader->Skip(num_values);
+	for (idx_t i = 0; i < child_readers.size(); i++) {
+		if (ReadsChild(i)) {
+			child_readers[i]->Skip(num_values);
+		}
 	}
 }
 
 void StructColumnReader::RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) {
-	for (auto &child : child_readers) {
-		child->RegisterPrefetch(transport, allow_merge);
+	for (idx_t i = 0; i < child_readers.size(); i++) {
+		if (ReadsChild(i)) {
+			child_readers[i]->RegisterPrefetch(transport, allow_merge);
+		}
 	}
 }
 
 uint64_t StructColumnReader::TotalCompressedSize() {
 	uint64_t size = 0;
-	for (auto &child : child_readers) {
-		size += child->TotalCompressedSize();
+	for (idx_t i = 0; i < child_readers.size(); i++) {
+		if (ReadsChild(i)) {
+			size += child_readers[i]->TotalCompressedSize();
+		}
 	}
 	return size;
 }
@@ -1131,12 +1329,19 @@ static bool TypeHasExactRowCount(const LogicalType &type) {
 }
 
 idx_t StructColumnReader::GroupRowsAvailable() {
+	optional_idx first_read_child;
 	for (idx_t i = 0; i < child_readers.size(); i++) {
+		if (!ReadsChild(i)) {
+			continue;
+		}
 		if (TypeHasExactRowCount(child_readers[i]->Type())) {
 			return child_readers[i]->GroupRowsAvailable();
 		}
+		if (!first_read_child.IsValid()) {
+			first_read_child = i;
+		}
 	}
-	return child_readers[0]->GroupRowsAvailable();
+	return child_readers[first_read_child.GetIndex()]->GroupRowsAvailable();
 }
 
 //===--------------------------------------------------------------------===//
@@ -1,6 +1,9 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
+#include "parquet_bss_encoder.hpp"
+#include "parquet_dbp_encoder.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -85,6 +88,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -310,13 +316,21 @@ struct PageInformation {
 	idx_t offset = 0;
 	idx_t row_count = 0;
 	idx_t empty_count = 0;
+	idx_t null_count = 0;
 	idx_t estimated_page_size = 0;
+
+	//! The number of (non-null) values that are written to the page
+	idx_t ValueCount() const {
+		return row_count - empty_count - null_count;
+	}
 };
 
 struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<MemoryStream> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of this page, used to build the ColumnIndex of the column chunk
+	unique_ptr<ColumnWriterStatistics> page_stats;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -339,6 +353,11 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+	//! The hashes of the values of the column chunk, used to build its bloom filter
+	vector<uint64_t> bloom_filter_hashes;
+	//! The page index and bloom filter of the column chunk, built in FinishWrite
+	unique_ptr<ParquetPageIndex> page_index;
+	unique_ptr<ParquetBloomFilter> bloom_filter;
 };
 
 //===--------------------------------------------------------------------===//
@@ -365,12 +384,15 @@ public:
 	static constexpr const idx_t MAX_DICTIONARY_KEY_SIZE = sizeof(uint32_t);
 	// the size of encoding the string length
 	static constexpr const idx_t STRING_LENGTH_SIZE = sizeof(uint32_t);
+	//! The maximum number of rows per page of non-repeated columns, so that the page index can be used to skip pages
+	static constexpr const idx_t MAX_PAGE_ROW_COUNT = 20480;
 
 public:
 	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override;
 	void Prepare(ColumnWriterState &state, ColumnWriterState *parent, Vector &vector, idx_t count) override;
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinishWrite(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 
 protected:
@@ -386,7 +408,7 @@ protected:
 	virtual unique_ptr<ColumnWriterStatistics> InitializeStatsState();
 
 	//! Initialize the writer for a specific page. Only used for scalar types.
-	virtual unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state);
+	virtual unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state, idx_t page_idx);
 
 	//! Flushes the writer for a specific page. Only used for scalar types.
 	virtual void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state);
@@ -396,6 +418,8 @@ protected:
 	//! Writes a (subset of a) vector to the specified serializer. Only used for scalar types.
 	virtual void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
 	                         Vector &vector, idx_t chunk_start, idx_t chunk_end) = 0;
+	//! Hashes the values of a vector for the bloom filter of the column chunk. Only used for scalar types.
+	virtual void HashVector(BasicColumnWriterState &state, Vector &vector, idx_t count);
 
 	virtual bool HasDictionary(BasicColumnWriterState &state_p) {
 		return false;
@@ -407,6 +431,8 @@ protected:
 
 	void SetParquetStatistics(BasicColumnWriterState &state, duckdb_parquet::format::ColumnChunk &column);
 	void RegisterToRowGroup(duckdb_parquet::format::RowGroup &row_group);
+	//! Fills in the ColumnIndex of the column chunk from the page statistics, returns false if it cannot be written
+	bool SetColumnIndex(BasicColumnWriterState &state, duckdb_parquet::format::ColumnIndex &column_index);
 };
 
 unique_ptr<ColumnWriterState> BasicColumnWriter::InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) {
@@ -425,7 +451,8 @@ void BasicColumnWriter::RegisterToRowGroup(duckdb_parquet::format::RowGroup &row
 	row_group.columns.push_back(std::move(column_chunk));
 }
 
-unique_ptr<ColumnWriterPageState> BasicColumnWriter::InitializePageState(BasicColumnWriterState &state) {
+unique_ptr<ColumnWriterPageState> BasicColumnWriter::InitializePageState(BasicColumnWriterState &state,
+                                                                        idx_t page_idx) {
 	return nullptr;
 }
 
@@ -454,13 +481,17 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 		}
 		if (validity.RowIsValid(vector_index)) {
 			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
-				PageInformation new_info;
-				new_info.offset = page_info.offset + page_info.row_count;
-				state.page_info.push_back(new_info);
-			}
+		} else {
+			page_info.null_count++;
 		}
 		vector_index++;
+		// pages of repeated columns could start in the middle of a row, so we only limit their size
+		if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE ||
+		    (max_repeat == 0 && page_info.row_count >= MAX_PAGE_ROW_COUNT)) {
+			PageInformation new_info;
+			new_info.offset = page_info.offset + page_info.row_count;
+			state.page_info.push_back(new_info);
+		}
 	}
 }
 
@@ -496,7 +527,8 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.temp_writer = make_uniq<MemoryStream>();
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
-		write_info.page_state = InitializePageState(state);
+		write_info.page_state = InitializePageState(state, page_idx);
+		write_info.page_stats = InitializeStatsState();
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -567,6 +599,7 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 	auto &hdr = write_info.page_header;
 
 	FlushPageState(temp_writer, write_info.page_state.get());
+	state.stats_state->Merge(*write_info.page_stats);
 
 	// now that we have finished writing the data we know the uncompressed size
 	if (temp_writer.GetPosition() > idx_t(NumericLimits<int32_t>::Maximum())) {
@@ -596,8 +629,15 @@ idx_t BasicColumnWriter::GetRowSize(Vector &vector, idx_t index, BasicColumnWrit
 	throw InternalException("GetRowSize unsupported for struct/list column writers");
 }
 
+void BasicColumnWriter::HashVector(BasicColumnWriterState &state, Vector &vector, idx_t count) {
+	throw InternalException("Bloom filters are not supported for this column writer");
+}
+
 void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t count) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
+	if (write_bloom_filter) {
+		HashVector(state, vector, count);
+	}
 
 	idx_t remaining = count;
 	idx_t offset = 0;
@@ -610,7 +650,7 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
+		WriteVector(temp_writer, write_info.page_stats.get(), write_info.page_state.get(), vector, offset,
 		            offset + write_count);
 
 		write_info.write_count += write_count;
@@ -661,45 +701,120 @@ void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
 		column_chunk.meta_data.__isset.statistics = true;
 	}
 	for (const auto &write_info : state.write_info) {
-		column_chunk.meta_data.encodings.push_back(write_info.page_header.data_page_header.encoding);
+		auto encoding = write_info.page_header.data_page_header.encoding;
+		auto &encodings = column_chunk.meta_data.encodings;
+		if (std::find(encodings.begin(), encodings.end(), encoding) == encodings.end()) {
+			encodings.push_back(encoding);
+		}
 	}
 }
 
-void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+bool BasicColumnWriter::SetColumnIndex(BasicColumnWriterState &state,
+                                       duckdb_parquet::format::ColumnIndex &column_index) {
+	if (max_repeat > 0) {
+		// the page index is only written for non-repeated columns, for which the values of a page are its rows
+		return false;
+	}
+	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
+		auto &page_info = state.page_info[page_idx];
+		auto &page_stats = *state.write_info[state.write_info.size() - state.page_info.size() + page_idx].page_stats;
+		auto is_null_page = page_info.null_count == page_info.row_count;
+		auto min_value = page_stats.GetMinValue();
+		auto max_value = page_stats.GetMaxValue();
+		if (!is_null_page && (min_value.empty() || max_value.empty())) {
+			// no statistics for this page (e.g. the type does not have any): we cannot write a column index
+			return false;
+		}
+		column_index.null_pages.push_back(is_null_page);
+		column_index.min_values.push_back(std::move(min_value));
+		column_index.max_values.push_back(std::move(max_value));
+		column_index.null_counts.push_back(NumericCast<int64_t>(page_info.null_count));
+	}
+	column_index.boundary_order = duckdb_parquet::format::BoundaryOrder::UNORDERED;
+	column_index.__isset.null_counts = true;
+	return true;
+}
+
+void BasicColumnWriter::FinishWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<BasicColumnWriterState>();
-	auto &column_chunk = state.row_group.columns[state.col_idx];
 
 	// flush the last page (if any remains)
 	FlushPage(state);
+	// flush the dictionary, this inserts the dictionary page in front of the data pages
+	if (HasDictionary(state)) {
+		FlushDictionary(state, state.stats_state.get());
+	}
+
+	if (max_repeat == 0) {
+		state.page_index = make_uniq<ParquetPageIndex>();
+		state.page_index->column_idx = state.col_idx;
+		state.page_index->has_column_index = SetColumnIndex(state, state.page_index->column_index);
+	}
+	if (write_bloom_filter) {
+		// size the bloom filter for the number of distinct values in the column chunk
+		auto &hashes = state.bloom_filter_hashes;
+		std::sort(hashes.begin(), hashes.end());
+		hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+		state.bloom_filter =
+		    make_uniq<ParquetBloomFilter>(hashes.size(), ParquetBloomFilter::DEFAULT_FALSE_POSITIVE_RATIO);
+		for (auto &hash : hashes) {
+			state.bloom_filter->FilterInsert(hash);
+		}
+		hashes.clear();
+	}
+}
+
+void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<BasicColumnWriterState>();
+	auto &column_chunk = state.row_group.columns[state.col_idx];
 
 	auto &column_writer = writer.GetWriter();
 	auto start_offset = column_writer.GetTotalWritten();
-	// flush the dictionary
 	if (HasDictionary(state)) {
-		column_chunk.meta_data.statistics.distinct_count = DictionarySize(state);
-		column_chunk.meta_data.statistics.__isset.distinct_count = true;
+		// the dictionary page is the first page that is written
 		column_chunk.meta_data.dictionary_page_offset = start_offset;
 		column_chunk.meta_data.__isset.dictionary_page_offset = true;
-		FlushDictionary(state, state.stats_state.get());
 	}
-
-	// record the start position of the pages for this column
-	column_chunk.meta_data.data_page_offset = column_writer.GetTotalWritten();
 	SetParquetStatistics(state, column_chunk);
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	idx_t data_page_count = 0;
 	for (auto &write_info : state.write_info) {
 		D_ASSERT(write_info.page_header.uncompressed_page_size > 0);
 		auto header_start_offset = column_writer.GetTotalWritten();
+		if (write_info.page_header.type == PageType::DATA_PAGE && data_page_count == 0) {
+			// record the start position of the data pages for this column
+			column_chunk.meta_data.data_page_offset = NumericCast<int64_t>(header_start_offset);
+		}
 		writer.Write(write_info.page_header);
 		// total uncompressed size in the column chunk includes the header size (!)
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+		if (write_info.page_header.type == PageType::DATA_PAGE) {
+			if (state.page_index) {
+				// record the location of the page in the offset index
+				auto &page_info = state.page_info[data_page_count];
+				duckdb_parquet::format::PageLocation page_location;
+				page_location.offset = NumericCast<int64_t>(header_start_offset);
+				page_location.compressed_page_size =
+				    NumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+				page_location.first_row_index = NumericCast<int64_t>(page_info.offset);
+				state.page_index->offset_index.page_locations.push_back(page_location);
+			}
+			data_page_count++;
+		}
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	if (state.page_index) {
+		writer.AddPageIndex(std::move(state.page_index));
+	}
+	if (state.bloom_filter) {
+		writer.AddBloomFilter(state.col_idx, std::move(state.bloom_filter));
+	}
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -769,6 +884,15 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -862,6 +986,81 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, idx_
 	}
 }
 
+//! The integer type with the same width as TGT, which is how values are encoded by DELTA_BINARY_PACKED
+template <class TGT>
+using ParquetPhysicalInteger = typename std::conditional<sizeof(TGT) == sizeof(int32_t), int32_t, int64_t>::type;
+
+//! Estimates the size of the values of a column chunk when encoded using DELTA_BINARY_PACKED
+class DbpSizeEstimate {
+public:
+	template <class T>
+	void Update(T value) {
+		if (value_count > 0) {
+			using UNSIGNED = typename std::make_unsigned<T>::type;
+			auto delta = int64_t(T(UNSIGNED(value) - UNSIGNED(T(previous_value))));
+			if (block_count == 0) {
+				min_delta = delta;
+				max_delta = delta;
+			} else {
+				min_delta = MinValue(min_delta, delta);
+				max_delta = MaxValue(max_delta, delta);
+			}
+			if (++block_count == DbpEncoder<T>::BLOCK_SIZE_IN_VALUES) {
+				FinishBlock();
+			}
+		}
+		previous_value = int64_t(value);
+		value_count++;
+	}
+
+	idx_t Finalize() {
+		if (block_count > 0) {
+			FinishBlock();
+		}
+		return estimated_size;
+	}
+
+	idx_t value_count = 0;
+
+private:
+	void FinishBlock() {
+		estimated_size += DbpEncoder<int64_t>::EstimateBlockSize(min_delta, max_delta, block_count);
+		block_count = 0;
+	}
+
+	int64_t previous_value = 0;
+	int64_t min_delta = 0;
+	int64_t max_delta = 0;
+	idx_t block_count = 0;
+	idx_t estimated_size = 0;
+};
+
+class StandardColumnWriterState : public BasicColumnWriterState {
+public:
+	StandardColumnWriterState(duckdb_parquet::format::RowGroup &row_group, idx_t col_idx)
+	    : BasicColumnWriterState(row_group, col_idx) {
+	}
+	~StandardColumnWriterState() override = default;
+
+	//! The encoding of the data pages of the column chunk
+	Encoding::type encoding = Encoding::PLAIN;
+	// analysis state
+	DbpSizeEstimate dbp_size_estimate;
+};
+
+template <class TGT>
+class StandardWriterPageState : public ColumnWriterPageState {
+public:
+	StandardWriterPageState(Encoding::type encoding, idx_t value_count)
+	    : encoding(encoding), dbp_encoder(value_count),
+	      bss_encoder(encoding == Encoding::BYTE_STREAM_SPLIT ? value_count : 0, sizeof(TGT)) {
+	}
+
+	Encoding::type encoding;
+	DbpEncoder<ParquetPhysicalInteger<TGT>> dbp_encoder;
+	BssEncoder bss_encoder;
+};
+
 template <class SRC, class TGT, class OP = ParquetCastOperator>
 class StandardColumnWriter : public BasicColumnWriter {
 public:
@@ -876,10 +1075,114 @@ public:
 		return OP::template InitializeStats<SRC, TGT>();
 	}
 
-	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
+	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override {
+		auto result = make_uniq<StandardColumnWriterState>(row_group, row_group.columns.size());
+		if (std::is_floating_point<TGT>::value && writer.GetParquetVersion() != ParquetVersion::V1 &&
+		    writer.GetCodec() != CompressionCodec::UNCOMPRESSED) {
+			// splitting the bytes of floating point values does not make them smaller, but it groups the (often
+			// similar) sign and exponent bytes together, which makes them compress a lot better
+			result->encoding = Encoding::BYTE_STREAM_SPLIT;
+		}
+		RegisterToRowGroup(row_group);
+		return std::move(result);
+	}
+
+	bool HasAnalyze() override {
+		// integers are analyzed to decide whether or not to use DELTA_BINARY_PACKED
+		return std::is_integral<TGT>::value && writer.GetParquetVersion() != ParquetVersion::V1;
+	}
+
+	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+
+		idx_t vcount = parent ? parent->definition_levels.size() - state.definition_levels.size() : count;
+		idx_t parent_index = state.definition_levels.size();
+		auto &validity = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<SRC>(vector);
+		idx_t vector_index = 0;
+		for (idx_t i = 0; i < vcount; i++) {
+			if (parent && !parent->is_empty.empty() && parent->is_empty[parent_index + i]) {
+				continue;
+			}
+			if (validity.RowIsValid(vector_index)) {
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[vector_index]);
+				state.dbp_size_estimate.Update(Load<ParquetPhysicalInteger<TGT>>(const_data_ptr_cast(&target_value)));
+			}
+			vector_index++;
+		}
+	}
+
+	void FinalizeAnalyze(ColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		auto plain_size = state.dbp_size_estimate.value_count * sizeof(TGT);
+		if (state.dbp_size_estimate.Finalize() < plain_size) {
+			state.encoding = Encoding::DELTA_BINARY_PACKED;
+		}
+	}
+
+	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		return state.encoding;
+	}
+
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p, idx_t page_idx) override {
+		auto &state = state_p.Cast<StandardColumnWriterState>();
+		if (state.encoding == Encoding::PLAIN) {
+			return nullptr;
+		}
+		return make_uniq<StandardWriterPageState<TGT>>(state.encoding, state.page_info[page_idx].ValueCount());
+	}
+
+	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
+		if (!state_p) {
+			return;
+		}
+		auto &page_state = state_p->Cast<StandardWriterPageState<TGT>>();
+		switch (page_state.encoding) {
+		case Encoding::DELTA_BINARY_PACKED:
+			page_state.dbp_encoder.FinishWrite(temp_writer);
+			break;
+		case Encoding::BYTE_STREAM_SPLIT:
+			page_state.bss_encoder.FinishWrite(temp_writer);
+			break;
+		default:
+			throw InternalException("Unsupported encoding for StandardColumnWriter");
+		}
+	}
+
+	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state_p,
 	                 Vector &input_column, idx_t chunk_start, idx_t chunk_end) override {
 		auto &mask = FlatVector::Validity(input_column);
-		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+		if (!page_state_p) {
+			TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+			return;
+		}
+		auto &page_state = page_state_p->Cast<StandardWriterPageState<TGT>>();
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (!mask.RowIsValid(r)) {
+				continue;
+			}
+			TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+			OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+			if (page_state.encoding == Encoding::DELTA_BINARY_PACKED) {
+				page_state.dbp_encoder.WriteValue(temp_writer,
+				                                  Load<ParquetPhysicalInteger<TGT>>(const_data_ptr_cast(&target_value)));
+			} else {
+				page_state.bss_encoder.WriteValue(target_value);
+			}
+		}
+	}
+
+	void HashVector(BasicColumnWriterState &state, Vector &input_column, idx_t count) override {
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+				state.bloom_filter_hashes.push_back(ParquetBloomFilter::Hash<TGT>(target_value));
+			}
+		}
 	}
 
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
@@ -915,6 +1218,11 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -963,7 +1271,7 @@ public:
 		}
 	}
 
-	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state) override {
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state, idx_t page_idx) override {
 		return make_uniq<BooleanWriterPageState>();
 	}
 
@@ -1046,6 +1354,13 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1227,6 +1542,19 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.values_too_big) {
+			values_too_big = true;
+			min = string();
+			max = string();
+			return;
+		}
+		if (other.HasStats()) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1240,32 +1568,67 @@ public:
 	idx_t estimated_dict_page_size = 0;
 	idx_t estimated_rle_pages_size = 0;
 	idx_t estimated_plain_size = 0;
+	//! The number of bytes that non-null values share with the preceding value (only computed for V2 files)
+	idx_t estimated_shared_prefix_size = 0;
+	idx_t value_count = 0;
+	string_t last_value;
 
 	// Dictionary and accompanying string heap
 	string_map_t<uint32_t> dictionary;
-	// key_bit_width== 0 signifies the chunk is written in plain encoding
+	// key_bit_width== 0 signifies the chunk is written without a dictionary
 	uint32_t key_bit_width;
+	//! The encoding of the data pages of the column chunk
+	Encoding::type encoding = Encoding::PLAIN;
 
 	bool IsDictionaryEncoded() {
 		return key_bit_width != 0;
 	}
 };
 
+static uint32_t GetSharedPrefixLength(const string_t &left, const string_t &right) {
+	auto max_length = MinValue(left.GetSize(), right.GetSize());
+	auto left_data = left.GetData();
+	auto right_data = right.GetData();
+	uint32_t length = 0;
+	while (length < max_length && left_data[length] == right_data[length]) {
+		length++;
+	}
+	return length;
+}
+
 class StringWriterPageState : public ColumnWriterPageState {
 public:
-	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values)
-	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false) {
+	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values, Encoding::type encoding,
+	                               idx_t value_count)
+	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false), encoding(encoding),
+	      length_encoder(value_count), suffix_length_encoder(value_count) {
 		D_ASSERT(IsDictionaryEncoded() || (bit_width == 0 && dictionary.empty()));
+		if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY || encoding == Encoding::DELTA_BYTE_ARRAY) {
+			data_stream = make_uniq<MemoryStream>();
+		}
+		if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+			suffix_length_stream = make_uniq<MemoryStream>();
+		}
 	}
 
 	bool IsDictionaryEncoded() {
 		return bit_width != 0;
 	}
-	// if 0, we're writing a plain page
+	// if 0, we're writing a page without a dictionary
 	uint32_t bit_width;
 	const string_map_t<uint32_t> &dictionary;
 	RleBpEncoder encoder;
 	bool written_value;
+
+	Encoding::type encoding;
+	//! The lengths (DELTA_LENGTH_BYTE_ARRAY) or prefix lengths (DELTA_BYTE_ARRAY), which are written first
+	DbpEncoder<int32_t> length_encoder;
+	//! The suffix lengths (DELTA_BYTE_ARRAY), which are written after the prefix lengths
+	DbpEncoder<int32_t> suffix_length_encoder;
+	unique_ptr<MemoryStream> suffix_length_stream;
+	//! The (suffixes of the) string data, which is written last
+	unique_ptr<MemoryStream> data_stream;
+	string_t previous_value;
 };
 
 class StringColumnWriter : public BasicColumnWriter {
@@ -1303,6 +1666,7 @@ public:
 		idx_t run_length = 0;
 		idx_t run_count = 0;
 		auto strings = FlatVector::GetData<string_t>(vector);
+		auto analyze_prefixes = writer.GetParquetVersion() != ParquetVersion::V1;
 		for (idx_t i = 0; i < vcount; i++) {
 			if (parent && !parent->is_empty.empty() && parent->is_empty[parent_index + i]) {
 				continue;
@@ -1314,6 +1678,13 @@ public:
 				// Try to insert into the dictionary. If it's already there, we get back the value index
 				auto found = state.dictionary.insert(string_map_t<uint32_t>::value_type(value, new_value_index));
 				state.estimated_plain_size += value.GetSize() + STRING_LENGTH_SIZE;
+				if (analyze_prefixes) {
+					if (state.value_count > 0) {
+						state.estimated_shared_prefix_size += GetSharedPrefixLength(state.last_value, value);
+					}
+					state.last_value = value;
+				}
+				state.value_count++;
 				if (found.second) {
 					// string didn't exist yet in the dictionary
 					new_value_index++;
@@ -1335,6 +1706,18 @@ public:
 		state.estimated_rle_pages_size += MAX_DICTIONARY_KEY_SIZE * run_count;
 	}
 
+	Encoding::type GetFallbackEncoding(StringColumnWriterState &state) {
+		if (writer.GetParquetVersion() == ParquetVersion::V1) {
+			return Encoding::PLAIN;
+		}
+		// both delta encodings store the lengths using DELTA_BINARY_PACKED, which usually takes (less than) a byte per
+		// value - DELTA_BYTE_ARRAY spends another one on the prefix length to avoid writing shared prefixes
+		auto string_size = state.estimated_plain_size - state.value_count * STRING_LENGTH_SIZE;
+		auto delta_length_size = string_size + state.value_count;
+		auto delta_size = string_size - state.estimated_shared_prefix_size + 2 * state.value_count;
+		return delta_size < delta_length_size ? Encoding::DELTA_BYTE_ARRAY : Encoding::DELTA_LENGTH_BYTE_ARRAY;
+	}
+
 	void FinalizeAnalyze(ColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
 
@@ -1342,11 +1725,13 @@ public:
 		// be too large
 		if (state.estimated_dict_page_size > MAX_UNCOMPRESSED_DICT_PAGE_SIZE ||
 		    state.estimated_rle_pages_size + state.estimated_dict_page_size > state.estimated_plain_size) {
-			// clearing the dictionary signals a plain write
+			// clearing the dictionary signals a write without a dictionary
 			state.dictionary.clear();
 			state.key_bit_width = 0;
+			state.encoding = GetFallbackEncoding(state);
 		} else {
 			state.key_bit_width = RleBpDecoder::ComputeBitWidth(state.dictionary.size());
+			state.encoding = state.IsDictionaryEncoded() ? Encoding::RLE_DICTIONARY : GetFallbackEncoding(state);
 		}
 	}
 
@@ -1363,6 +1748,8 @@ public:
 				if (!mask.RowIsValid(r)) {
 					continue;
 				}
+				// the dictionary statistics only cover the column chunk - track the page statistics separately
+				stats.Update(ptr[r]);
 				auto value_index = page_state.dictionary.at(ptr[r]);
 				if (!page_state.written_value) {
 					// first value
@@ -1375,6 +1762,34 @@ public:
 					page_state.encoder.WriteValue(temp_writer, value_index);
 				}
 			}
+		} else if (page_state.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (!mask.RowIsValid(r)) {
+					continue;
+				}
+				stats.Update(ptr[r]);
+				page_state.length_encoder.WriteValue(temp_writer, NumericCast<int32_t>(ptr[r].GetSize()));
+				page_state.data_stream->WriteData(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize());
+			}
+		} else if (page_state.encoding == Encoding::DELTA_BYTE_ARRAY) {
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (!mask.RowIsValid(r)) {
+					continue;
+				}
+				stats.Update(ptr[r]);
+				uint32_t prefix_length = 0;
+				if (page_state.written_value) {
+					prefix_length = GetSharedPrefixLength(page_state.previous_value, ptr[r]);
+				}
+				auto suffix_length = ptr[r].GetSize() - prefix_length;
+				page_state.length_encoder.WriteValue(temp_writer, NumericCast<int32_t>(prefix_length));
+				page_state.suffix_length_encoder.WriteValue(*page_state.suffix_length_stream,
+				                                            NumericCast<int32_t>(suffix_length));
+				page_state.data_stream->WriteData(const_data_ptr_cast(ptr[r].GetData() + prefix_length),
+				                                  suffix_length);
+				page_state.previous_value = ptr[r];
+				page_state.written_value = true;
+			}
 		} else {
 			// plain page
 			for (idx_t r = chunk_start; r < chunk_end; r++) {
@@ -1388,9 +1803,26 @@ public:
 		}
 	}
 
-	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
+	void HashVector(BasicColumnWriterState &state_p, Vector &input_column, idx_t count) override {
+		auto &state = state_p.Cast<StringColumnWriterState>();
+		if (state.IsDictionaryEncoded()) {
+			// the values of dictionary-encoded column chunks are hashed when the dictionary is flushed
+			return;
+		}
+		auto &mask = FlatVector::Validity(input_column);
+		auto *ptr = FlatVector::GetData<string_t>(input_column);
+		for (idx_t r = 0; r < count; r++) {
+			if (mask.RowIsValid(r)) {
+				state.bloom_filter_hashes.push_back(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize()));
+			}
+		}
+	}
+
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p, idx_t page_idx) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
+		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary, state.encoding,
+		                                        state.page_info[page_idx].ValueCount());
 	}
 
 	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
@@ -1403,12 +1835,25 @@ public:
 				return;
 			}
 			page_state.encoder.FinishWrite(temp_writer);
+			return;
+		}
+		if (page_state.encoding == Encoding::DELTA_BYTE_ARRAY) {
+			// <prefix lengths> <suffix lengths> <suffixes>
+			page_state.length_encoder.FinishWrite(temp_writer);
+			page_state.suffix_length_encoder.FinishWrite(*page_state.suffix_length_stream);
+			temp_writer.WriteData(page_state.suffix_length_stream->GetData(),
+			                      page_state.suffix_length_stream->GetPosition());
+			temp_writer.WriteData(page_state.data_stream->GetData(), page_state.data_stream->GetPosition());
+		} else if (page_state.encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+			// <lengths> <strings>
+			page_state.length_encoder.FinishWrite(temp_writer);
+			temp_writer.WriteData(page_state.data_stream->GetData(), page_state.data_stream->GetPosition());
 		}
 	}
 
 	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return state.IsDictionaryEncoded() ? Encoding::RLE_DICTIONARY : Encoding::PLAIN;
+		return state.encoding;
 	}
 
 	bool HasDictionary(BasicColumnWriterState &state_p) override {
@@ -1440,6 +1885,10 @@ public:
 			auto &value = values[r];
 			// update the statistics
 			stats.Update(value);
+			if (write_bloom_filter) {
+				state.bloom_filter_hashes.push_back(
+				    ParquetBloomFilter::Hash(const_data_ptr_cast(value.GetData()), value.GetSize()));
+			}
 			// write this string value to the dictionary
 			temp_writer->Write<uint32_t>(value.GetSize());
 			temp_writer->WriteData(const_data_ptr_cast((value.GetData())), value.GetSize());
@@ -1528,7 +1977,7 @@ public:
 		}
 	}
 
-	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state) override {
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state, idx_t page_idx) override {
 		return make_uniq<EnumWriterPageState>(bit_width);
 	}
 
@@ -1603,6 +2052,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinishWrite(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1692,6 +2142,13 @@ void StructColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 	}
 }
 
+void StructColumnWriter::FinishWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<StructColumnWriterState>();
+	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
+		child_writers[child_idx]->FinishWrite(*state.child_states[child_idx]);
+	}
+}
+
 void StructColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<StructColumnWriterState>();
 	for (idx_t child_idx = 0; child_idx < child_writers.size(); child_idx++) {
@@ -1724,6 +2181,7 @@ public:
 
 	void BeginWrite(ColumnWriterState &state) override;
 	void Write(ColumnWriterState &state, Vector &vector, idx_t count) override;
+	void FinishWrite(ColumnWriterState &state) override;
 	void FinalizeWrite(ColumnWriterState &state) override;
 };
 
@@ -1866,6 +2324,11 @@ void ListColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t c
 	child_writer->Write(*state.child_state, child_list, child_length);
 }
 
+void ListColumnWriter::FinishWrite(ColumnWriterState &state_p) {
+	auto &state = state_p.Cast<ListColumnWriterState>();
+	child_writer->FinishWrite(*state.child_state);
+}
+
 void ListColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<ListColumnWriterState>();
 	child_writer->FinalizeWrite(*state.child_state);
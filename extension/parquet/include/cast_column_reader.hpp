@@ -45,6 +45,10 @@ public:
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override {
 		child_reader->RegisterPrefetch(transport, allow_merge);
 	}
+
+	bool CanSkipWithPageIndex() const override {
+		return false;
+	}
 };
 
 } // namespace duckdb
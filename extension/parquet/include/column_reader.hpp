@@ -33,6 +33,7 @@ using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::CompressionCodec;
 using duckdb_parquet::format::FieldRepetitionType;
 using duckdb_parquet::format::PageHeader;
+using duckdb_parquet::format::PageLocation;
 using duckdb_parquet::format::SchemaElement;
 using duckdb_parquet::format::Type;
 
@@ -70,6 +71,19 @@ public:
 
 	virtual unique_ptr<BaseStatistics> Stats(idx_t row_group_idx_p, const vector<ColumnChunk> &columns);
 
+	//! Whether or not the page index of the current column chunk can be used, i.e. whether this reader decodes the
+	//! pages of a non-repeated column chunk itself
+	bool CanUsePageIndex() const;
+	//! Sets the page locations of the current column chunk (from its OffsetIndex). Skips jump over whole pages, and the
+	//! pages that lie entirely within the pruned row ranges are not prefetched.
+	void SetPageIndex(vector<PageLocation> page_locations, const vector<pair<idx_t, idx_t>> &pruned_ranges);
+	//! Whether or not Skip() can jump to any row of a column chunk without decoding the rows before it, given the page
+	//! index of the chunk. This holds for the readers of non-repeated leaf columns, but not for the readers that wrap
+	//! other readers.
+	virtual bool CanSkipWithPageIndex() const {
+		return max_repeat == 0;
+	}
+
 	template <class VALUE_TYPE, class CONVERSION>
 	void PlainTemplated(shared_ptr<ByteBuffer> plain_data, uint8_t *defines, uint64_t num_values,
 	                    parquet_filter_t &filter, idx_t result_offset, Vector &result) {
@@ -143,6 +157,8 @@ private:
 	void PreparePageV2(PageHeader &page_hdr);
 	void DecompressInternal(CompressionCodec::type codec, const_data_ptr_t src, idx_t src_size, data_ptr_t dst,
 	                        idx_t dst_size);
+	//! Jumps over the pages that are skipped entirely (using the page index), returns the number of skipped values
+	idx_t SkipPages(idx_t num_values);
 
 	const duckdb_parquet::format::ColumnChunk *chunk = nullptr;
 
@@ -151,6 +167,11 @@ private:
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
 
+	//! The page locations of the current column chunk (if we have read its OffsetIndex)
+	vector<PageLocation> page_locations;
+	//! For every page, whether or not it lies entirely within the row ranges that are skipped by the scan
+	vector<bool> pruned_pages;
+
 	shared_ptr<ResizeableBuffer> block;
 
 	ResizeableBuffer compressed_buffer;
@@ -48,6 +48,8 @@ public:
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Merges the statistics of a single page into the statistics of the column chunk
+	virtual void Merge(ColumnWriterStatistics &other);
 
 public:
 	template <class TARGET>
@@ -75,6 +77,8 @@ public:
 	idx_t max_repeat;
 	idx_t max_define;
 	bool can_have_nulls;
+	//! Whether or not a bloom filter is written for the column chunks of this column
+	bool write_bloom_filter = false;
 
 public:
 	//! Create the column writer for a specific type recursively
@@ -105,6 +109,10 @@ public:
 
 	virtual void BeginWrite(ColumnWriterState &state) = 0;
 	virtual void Write(ColumnWriterState &state, Vector &vector, idx_t count) = 0;
+	//! Called after all data has been passed to Write - finishes the (CPU intensive) encoding and compression of the
+	//! column chunk. This does not touch the file, so it can run in parallel with the writes of other row groups.
+	virtual void FinishWrite(ColumnWriterState &state) = 0;
+	//! Writes the finished column chunk to the file, this is called for one row group at a time
 	virtual void FinalizeWrite(ColumnWriterState &state) = 0;
 
 protected:
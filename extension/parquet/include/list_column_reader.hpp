@@ -28,6 +28,7 @@ public:
 
 	void InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns, TProtocol &protocol_p) override {
 		child_column_reader->InitializeRead(row_group_idx_p, columns, protocol_p);
+		pending_skips = 0;
 	}
 
 	idx_t GroupRowsAvailable() override {
@@ -42,6 +43,10 @@ public:
 		child_column_reader->RegisterPrefetch(transport, allow_merge);
 	}
 
+	bool CanSkipWithPageIndex() const override {
+		return false;
+	}
+
 private:
 	unique_ptr<ColumnReader> child_column_reader;
 	ResizeableBuffer child_defines;
@@ -55,6 +60,10 @@ private:
 	parquet_filter_t child_filter;
 
 	idx_t overflow_child_count;
+	//! Whether the child is not nested, in which case its values can be read into the result vector directly
+	bool primitive_child;
+	//! The largest child list size of the reads so far
+	idx_t child_capacity_hint;
 };
 
 } // namespace duckdb
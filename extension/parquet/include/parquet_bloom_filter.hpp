@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/types/value.hpp"
+#endif
+#include "parquet_types.h"
+
+namespace duckdb {
+
+//! A Split Block Bloom Filter (SBBF) as defined by the Parquet specification. The filter consists of blocks of 256
+//! bits, a value sets (or checks) one bit in each of the eight 32-bit words of a single block.
+class ParquetBloomFilter {
+public:
+	//! Create an empty bloom filter sized for the given number of distinct values and false positive ratio
+	ParquetBloomFilter(idx_t num_distinct_values, double false_positive_ratio);
+	//! Create a bloom filter from a serialized bitset
+	explicit ParquetBloomFilter(vector<uint32_t> words);
+
+	static constexpr const idx_t BLOCK_SIZE = 32;
+	static constexpr const idx_t WORDS_PER_BLOCK = 8;
+	static constexpr const idx_t MINIMUM_BYTES = BLOCK_SIZE;
+	static constexpr const idx_t MAXIMUM_BYTES = 1024 * 1024;
+	static constexpr const double DEFAULT_FALSE_POSITIVE_RATIO = 0.01;
+
+public:
+	void FilterInsert(uint64_t hash);
+	bool FilterCheck(uint64_t hash) const;
+
+	idx_t SizeInBytes() const {
+		return words.size() * sizeof(uint32_t);
+	}
+
+	//! Writes the BloomFilterHeader followed by the bitset
+	void Write(duckdb_apache::thrift::protocol::TProtocol &protocol) const;
+	//! Reads a BloomFilterHeader followed by the bitset from the current location of the protocol. Returns nullptr if
+	//! the filter uses an algorithm, hash or compression that is not supported.
+	static unique_ptr<ParquetBloomFilter> Read(duckdb_apache::thrift::protocol::TProtocol &protocol);
+
+	//! Hashes the plain-encoded representation of a value
+	static uint64_t Hash(const_data_ptr_t data, idx_t size);
+	template <class T>
+	static uint64_t Hash(T value) {
+		return Hash(const_data_ptr_cast(&value), sizeof(T));
+	}
+	//! Hashes a constant as it is encoded by the writer for a column of the given Parquet type, returns false if the
+	//! constant cannot be hashed (i.e. the bloom filter cannot be used to check for it)
+	static bool TryHashConstant(const Value &constant, duckdb_parquet::format::Type::type parquet_type, uint64_t &hash);
+	//! Whether or not a bloom filter can be written for a column of the given type
+	static bool TypeIsSupported(const LogicalType &type);
+
+private:
+	vector<uint32_t> words;
+};
+
+} // namespace duckdb
@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bss_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the Byte Stream Split encoding, the counterpart of the BssDecoder. Byte i of every value is written to
+//! stream i, the total number of values has to be known up front to know where each stream starts.
+class BssEncoder {
+public:
+	BssEncoder(idx_t total_value_count, idx_t type_size)
+	    : total_value_count(total_value_count), type_size(type_size), value_count(0),
+	      buffer(new data_t[total_value_count * type_size]) {
+	}
+
+public:
+	template <class T>
+	void WriteValue(const T &value) {
+		D_ASSERT(sizeof(T) == type_size && value_count < total_value_count);
+		auto value_ptr = const_data_ptr_cast(&value);
+		for (idx_t byte_idx = 0; byte_idx < sizeof(T); byte_idx++) {
+			buffer[byte_idx * total_value_count + value_count] = value_ptr[byte_idx];
+		}
+		value_count++;
+	}
+
+	void FinishWrite(WriteStream &writer) {
+		D_ASSERT(value_count == total_value_count);
+		writer.WriteData(buffer.get(), total_value_count * type_size);
+	}
+
+private:
+	idx_t total_value_count;
+	idx_t type_size;
+	idx_t value_count;
+	unique_ptr<data_t[]> buffer;
+};
+
+} // namespace duckdb
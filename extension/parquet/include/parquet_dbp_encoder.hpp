@@ -0,0 +1,150 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dbp_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "decode_utils.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the DELTA_BINARY_PACKED encoding, the counterpart of the DbpDecoder. T is the physical type of the
+//! values (int32_t or int64_t), the total number of values has to be known up front as it is part of the header.
+template <class T>
+class DbpEncoder {
+	static_assert(std::is_same<T, int32_t>::value || std::is_same<T, int64_t>::value,
+	              "DELTA_BINARY_PACKED is only defined for INT32 and INT64");
+
+public:
+	static constexpr const idx_t BLOCK_SIZE_IN_VALUES = 128;
+	static constexpr const idx_t NUMBER_OF_MINIBLOCKS_IN_A_BLOCK = 4;
+	static constexpr const idx_t NUMBER_OF_VALUES_IN_A_MINIBLOCK =
+	    BLOCK_SIZE_IN_VALUES / NUMBER_OF_MINIBLOCKS_IN_A_BLOCK;
+
+public:
+	explicit DbpEncoder(idx_t total_value_count)
+	    : total_value_count(total_value_count), value_count(0), previous_value(0), delta_count(0) {
+	}
+
+public:
+	void WriteValue(WriteStream &writer, T value) {
+		if (value_count == 0) {
+			WriteHeader(writer, value);
+		} else {
+			// deltas wrap around in the width of the physical type, and so does the decoding
+			using UNSIGNED = typename std::make_unsigned<T>::type;
+			deltas[delta_count++] = int64_t(T(UNSIGNED(value) - UNSIGNED(previous_value)));
+			if (delta_count == BLOCK_SIZE_IN_VALUES) {
+				WriteBlock(writer);
+			}
+		}
+		previous_value = value;
+		value_count++;
+	}
+
+	void FinishWrite(WriteStream &writer) {
+		D_ASSERT(value_count == total_value_count);
+		if (value_count == 0) {
+			WriteHeader(writer, 0);
+			return;
+		}
+		if (delta_count > 0) {
+			WriteBlock(writer);
+		}
+	}
+
+	//! Estimates the number of bytes needed to encode a block of deltas, used to decide whether or not to use this
+	//! encoding before actually writing anything
+	static idx_t EstimateBlockSize(int64_t min_delta, int64_t max_delta, idx_t count) {
+		auto width = BitpackingPrimitives::MinimumBitWidth<uint64_t>(uint64_t(max_delta) - uint64_t(min_delta));
+		return sizeof(int64_t) + NUMBER_OF_MINIBLOCKS_IN_A_BLOCK + (count * width + 7) / 8;
+	}
+
+private:
+	void WriteHeader(WriteStream &writer, T first_value) {
+		// <block size in values> <number of miniblocks in a block> <total value count> <first value>
+		VarintEncode(BLOCK_SIZE_IN_VALUES, writer);
+		VarintEncode(NUMBER_OF_MINIBLOCKS_IN_A_BLOCK, writer);
+		VarintEncode(total_value_count, writer);
+		VarintEncode(IntToZigzag(first_value), writer);
+	}
+
+	void WriteBlock(WriteStream &writer) {
+		D_ASSERT(delta_count > 0 && delta_count <= BLOCK_SIZE_IN_VALUES);
+		// <min delta> <list of bitwidths of miniblocks> <miniblocks>
+		int64_t min_delta = deltas[0];
+		for (idx_t i = 1; i < delta_count; i++) {
+			min_delta = MinValue(min_delta, deltas[i]);
+		}
+		VarintEncode(IntToZigzag(min_delta), writer);
+
+		// the deltas are stored relative to the min delta, the last miniblock is padded with zeroes
+		uint64_t relative_deltas[BLOCK_SIZE_IN_VALUES];
+		for (idx_t i = 0; i < delta_count; i++) {
+			relative_deltas[i] = uint64_t(deltas[i]) - uint64_t(min_delta);
+		}
+		for (idx_t i = delta_count; i < BLOCK_SIZE_IN_VALUES; i++) {
+			relative_deltas[i] = 0;
+		}
+		// miniblocks that are not needed are not written, but their bit width is (by convention it is 0)
+		auto miniblock_count = (delta_count + NUMBER_OF_VALUES_IN_A_MINIBLOCK - 1) / NUMBER_OF_VALUES_IN_A_MINIBLOCK;
+		bitpacking_width_t widths[NUMBER_OF_MINIBLOCKS_IN_A_BLOCK];
+		for (idx_t miniblock_idx = 0; miniblock_idx < NUMBER_OF_MINIBLOCKS_IN_A_BLOCK; miniblock_idx++) {
+			widths[miniblock_idx] = 0;
+			if (miniblock_idx < miniblock_count) {
+				auto miniblock = relative_deltas + miniblock_idx * NUMBER_OF_VALUES_IN_A_MINIBLOCK;
+				uint64_t max_delta = 0;
+				for (idx_t i = 0; i < NUMBER_OF_VALUES_IN_A_MINIBLOCK; i++) {
+					max_delta = MaxValue(max_delta, miniblock[i]);
+				}
+				widths[miniblock_idx] = BitpackingPrimitives::MinimumBitWidth<uint64_t>(max_delta);
+			}
+			writer.Write<uint8_t>(widths[miniblock_idx]);
+		}
+		// a miniblock of 32 values always packs into a whole number of bytes
+		data_t packed[NUMBER_OF_VALUES_IN_A_MINIBLOCK * sizeof(uint64_t)];
+		for (idx_t miniblock_idx = 0; miniblock_idx < miniblock_count; miniblock_idx++) {
+			auto width = widths[miniblock_idx];
+			if (width == 0) {
+				continue;
+			}
+			BitpackingPrimitives::PackBlock<uint64_t>(
+			    packed, relative_deltas + miniblock_idx * NUMBER_OF_VALUES_IN_A_MINIBLOCK, width);
+			writer.WriteData(packed, NUMBER_OF_VALUES_IN_A_MINIBLOCK * width / 8);
+		}
+		delta_count = 0;
+	}
+
+	static uint64_t IntToZigzag(int64_t value) {
+		return (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+	}
+
+	static void VarintEncode(uint64_t value, WriteStream &writer) {
+		do {
+			uint8_t byte = value & 127;
+			value >>= 7;
+			if (value != 0) {
+				byte |= 128;
+			}
+			writer.Write<uint8_t>(byte);
+		} while (value != 0);
+	}
+
+private:
+	idx_t total_value_count;
+	idx_t value_count;
+	T previous_value;
+
+	int64_t deltas[BLOCK_SIZE_IN_VALUES];
+	idx_t delta_count;
+};
+
+} // namespace duckdb
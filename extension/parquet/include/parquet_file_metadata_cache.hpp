@@ -9,11 +9,16 @@
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/storage/object_cache.hpp"
 #endif
+#include "parquet_bloom_filter.hpp"
 #include "parquet_types.h"
 
 namespace duckdb {
+class ParquetEncryptionConfig;
 
 //! ParquetFileMetadataCache
 class ParquetFileMetadataCache : public ObjectCacheEntry {
@@ -21,7 +26,7 @@ public:
 	ParquetFileMetadataCache() : metadata(nullptr) {
 	}
 	ParquetFileMetadataCache(unique_ptr<duckdb_parquet::format::FileMetaData> file_metadata, time_t r_time)
-	    : metadata(std::move(file_metadata)), read_time(r_time) {
+	    : metadata(std::move(file_metadata)), read_time(r_time), estimated_size(EstimateSize(*metadata)) {
 	}
 
 	~ParquetFileMetadataCache() override = default;
@@ -32,6 +37,26 @@ public:
 	//! read time
 	time_t read_time;
 
+	//! The estimated memory usage of the parsed metadata
+	idx_t estimated_size = 0;
+
+public:
+	//! Looks up the bloom filter stored at the given offset of the file, returns false if it has not been read yet
+	bool TryGetBloomFilter(idx_t offset, shared_ptr<ParquetBloomFilter> &result) {
+		lock_guard<mutex> guard(bloom_filter_lock);
+		auto entry = bloom_filters.find(offset);
+		if (entry == bloom_filters.end()) {
+			return false;
+		}
+		result = entry->second;
+		return true;
+	}
+	//! Caches the bloom filter stored at the given offset of the file (nullptr if it cannot be used)
+	void AddBloomFilter(idx_t offset, shared_ptr<ParquetBloomFilter> bloom_filter) {
+		lock_guard<mutex> guard(bloom_filter_lock);
+		bloom_filters[offset] = std::move(bloom_filter);
+	}
+
 public:
 	static string ObjectType() {
 		return "parquet_metadata";
@@ -40,5 +65,64 @@ public:
 	string GetObjectType() override {
 		return ObjectType();
 	}
+
+	optional_idx GetEstimatedCacheMemory() const override {
+		return estimated_size;
+	}
+
+	static idx_t EstimateSize(const duckdb_parquet::format::FileMetaData &metadata);
+
+private:
+	mutex bloom_filter_lock;
+	//! The bloom filters that have been read from the file, indexed by their offset
+	unordered_map<idx_t, shared_ptr<ParquetBloomFilter>> bloom_filters;
+};
+
+//! Stores the footers of Parquet files in a local directory, so they outlive the database instance. The footers are
+//! keyed by the path of the file, and are only used if the size and last modification time of the file still match.
+//! Reading and writing the footer cache is best-effort: failures are treated as cache misses.
+class ParquetFooterCache {
+public:
+	static constexpr const char *MAGIC_BYTES = "DPQF";
+	static constexpr const char *FILE_EXTENSION = ".parquet_footer";
+
+public:
+	ParquetFooterCache(FileSystem &fs, Allocator &allocator, string directory);
+
+	//! Reads the footer of the file from the cache, returns nullptr if there is no (up-to-date) footer
+	shared_ptr<ParquetFileMetadataCache> Read(const string &path, idx_t file_size, time_t last_modified);
+	//! Writes the (unencrypted) footer of the file to the cache
+	void Write(const string &path, idx_t file_size, time_t last_modified, time_t read_time, const_data_ptr_t footer,
+	           uint32_t footer_len);
+
+private:
+	string GetCachePath(const string &path) const;
+
+private:
+	FileSystem &fs;
+	Allocator &allocator;
+	string directory;
+};
+
+//! Provides the metadata of Parquet files, going through the object cache and the footer cache if they are enabled
+class ParquetMetadataProvider {
+public:
+	explicit ParquetMetadataProvider(ClientContext &context);
+
+	//! Returns the metadata of the opened file
+	shared_ptr<ParquetFileMetadataCache>
+	GetMetadata(FileHandle &file_handle, const shared_ptr<const ParquetEncryptionConfig> &encryption_config);
+	//! Reads the footers of the files that are not in the object cache yet into it, using multiple threads
+	void Prefetch(const vector<string> &files, const shared_ptr<const ParquetEncryptionConfig> &encryption_config);
+
+private:
+	FileSystem &fs;
+	Allocator &allocator;
+	//! The object cache, if it is enabled
+	optional_ptr<ObjectCache> object_cache;
+	//! The footer cache, if a directory is configured
+	unique_ptr<ParquetFooterCache> footer_cache;
+	//! The number of threads that are used to prefetch footers
+	idx_t prefetch_threads;
 };
 } // namespace duckdb
@@ -0,0 +1,93 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_manifest.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/function/function_set.hpp"
+#include "duckdb/planner/expression.hpp"
+#endif
+
+namespace duckdb {
+class ParquetReader;
+class LogicalGet;
+
+//! The statistics of a column of a Parquet file, merged over all of its row groups
+struct ParquetManifestColumn {
+	string name;
+	//! Whether or not min and max are set, i.e. whether every row group has (exact) min/max statistics for the column
+	bool has_min_max = false;
+	Value min;
+	Value max;
+	//! Whether or not every row group has a null count for the column
+	bool has_null_count = false;
+	idx_t null_count = 0;
+
+public:
+	void Serialize(Serializer &serializer) const;
+	static ParquetManifestColumn Deserialize(Deserializer &deserializer);
+};
+
+//! The entry of a single Parquet file in a manifest
+struct ParquetManifestFile {
+	string file_name;
+	idx_t row_count = 0;
+	vector<ParquetManifestColumn> columns;
+
+public:
+	//! Gathers the manifest entry of a file from its footer
+	static ParquetManifestFile FromReader(ParquetReader &reader);
+	optional_ptr<const ParquetManifestColumn> GetColumn(const string &name) const;
+
+	void Serialize(Serializer &serializer) const;
+	static ParquetManifestFile Deserialize(Deserializer &deserializer);
+};
+
+//! A ParquetManifest is a (local) sidecar file that stores the row counts and column statistics of a set of Parquet
+//! files. A scan that is given a manifest uses it to skip the files that cannot contain any rows that pass the filters,
+//! without having to open these files and read their footers. The manifest has to be rebuilt when the files change,
+//! files that are not in the manifest are always scanned.
+class ParquetManifest {
+public:
+	static constexpr const char *MAGIC_BYTES = "DPQM";
+	static constexpr const idx_t MANIFEST_VERSION = 1;
+
+	idx_t version = MANIFEST_VERSION;
+	vector<ParquetManifestFile> files;
+
+public:
+	static unique_ptr<ParquetManifest> Read(ClientContext &context, const string &path);
+	void Write(ClientContext &context, const string &path) const;
+	void AddFile(ParquetManifestFile file);
+
+	//! Removes the files that cannot contain any rows that pass the filters, returns true if any file was removed
+	bool PruneFiles(vector<string> &file_list, LogicalGet &get, const vector<unique_ptr<Expression>> &filters) const;
+	//! Sums up the row counts of the files, returns false if any of them is not in the manifest
+	bool TryGetRowCount(const vector<string> &file_list, idx_t &result) const;
+
+	void Serialize(Serializer &serializer) const;
+	static unique_ptr<ParquetManifest> Deserialize(Deserializer &deserializer);
+
+private:
+	optional_ptr<const ParquetManifestFile> GetFile(const string &file_name) const;
+
+private:
+	//! Maps the file names to their index in files
+	unordered_map<string, idx_t> file_map;
+};
+
+//! parquet_build_manifest(files, manifest_path) builds the manifest of a set of Parquet files
+class ParquetBuildManifestFunction {
+public:
+	static TableFunctionSet GetFunctionSet();
+};
+
+} // namespace duckdb
@@ -16,6 +16,7 @@
 #include "duckdb/common/multi_file_reader_options.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/execution/adaptive_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
@@ -26,6 +27,8 @@
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_types.h"
 #include "resizable_buffer.hpp"
+#include "struct_column_reader.hpp"
+#include "thrift_tools.hpp"
 
 #include <exception>
 
@@ -45,6 +48,14 @@ class ParquetEncryptionConfig;
 struct ParquetReaderPrefetchConfig {
 	// Percentage of data in a row group span that should be scanned for enabling whole group prefetch
 	static constexpr double WHOLE_GROUP_PREFETCH_MINIMUM_SCAN = 0.95;
+	// Maximum number of ranges of a file that are fetched at the same time by a scan
+	static constexpr idx_t MAXIMUM_CONCURRENT_FETCHES = 4;
+};
+
+struct ParquetReaderScanConfig {
+	// Minimum number of rows in a part of a row group, row groups with at least twice as many rows can be split into
+	// parts that are scanned in parallel
+	static constexpr idx_t MINIMUM_GROUP_PART_ROWS = 122880;
 };
 
 struct ParquetReaderScanState {
@@ -52,17 +63,26 @@ struct ParquetReaderScanState {
 	int64_t current_group;
 	idx_t group_offset;
 	unique_ptr<FileHandle> file_handle;
+	//! Additional handles to the file, used to fetch the prefetched ranges concurrently
+	unique_ptr<ConcurrentFetchHandles> fetch_handles;
 	unique_ptr<ColumnReader> root_reader;
 	unique_ptr<duckdb_apache::thrift::protocol::TProtocol> thrift_file_proto;
 
 	bool finished;
-	SelectionVector sel;
+	//! Determines the order in which the filters are evaluated, based on how expensive they have been so far
+	unique_ptr<AdaptiveFilter> adaptive_filter;
 
 	ResizeableBuffer define_buf;
 	ResizeableBuffer repeat_buf;
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! The (sorted, non-overlapping) row ranges of the current group that are pruned using the page index
+	vector<pair<idx_t, idx_t>> pruned_ranges;
+	//! The range of rows of each group that is scanned, used to scan the parts of a large row group in parallel
+	idx_t group_row_start = 0;
+	idx_t group_row_end = NumericLimits<idx_t>::Maximum();
 };
 
 struct ParquetColumnDefinition {
@@ -88,6 +108,8 @@ struct ParquetOptions {
 	bool binary_as_string = false;
 	bool file_row_number = false;
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
+	//! The path of the manifest that is used to skip files, if any
+	string manifest_path;
 
 	MultiFileReaderOptions file_options;
 	vector<ParquetColumnDefinition> schema;
@@ -114,17 +136,27 @@ public:
 	MultiFileReaderData reader_data;
 	unique_ptr<ColumnReader> root_reader;
 
+	//! The used fields of the STRUCT columns that are not read entirely, indexed by their column index in the file
+	unordered_map<idx_t, ParquetStructProjection> struct_projections;
 	//! Index of the file_row_number column
 	idx_t file_row_number_idx = DConstants::INVALID_INDEX;
+	//! Whether the prefetching mechanism is used for local files as well (by default only remote files are prefetched)
+	bool prefetch_all_files = false;
 	//! Parquet schema for the generated columns
 	vector<duckdb_parquet::format::SchemaElement> generated_column_schema;
 
 public:
 	void InitializeScan(ParquetReaderScanState &state, vector<idx_t> groups_to_read);
+	//! Initializes a scan of the rows [row_start, row_end) of a single group
+	void InitializeScan(ParquetReaderScanState &state, idx_t group_idx, idx_t row_start, idx_t row_end);
 	void Scan(ParquetReaderScanState &state, DataChunk &output);
 
 	idx_t NumRows();
 	idx_t NumRowGroups();
+	idx_t NumGroupRows(idx_t group_idx);
+	//! Whether or not the rows of a group can be scanned in parts, which requires all scanned columns to be able to jump
+	//! to the start of a part using the page index rather than decoding all rows before it
+	bool CanScanGroupInParts(idx_t group_idx);
 
 	const duckdb_parquet::format::FileMetaData *GetFileMetadata();
 
@@ -162,6 +194,14 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Uses the bloom filters and page indexes of the filtered columns to find the rows of the current group that can be
+	//! skipped
+	void PrunePages(ParquetReaderScanState &state);
+	//! Returns the (cached) bloom filter of a column chunk, or nullptr if the chunk does not have a usable one
+	shared_ptr<ParquetBloomFilter> GetBloomFilter(ParquetReaderScanState &state,
+	                                              const duckdb_parquet::format::ColumnChunk &column_chunk);
+	//! Uses the bloom filter of a column chunk of the current group to check whether the filter can be true for any row
+	bool BloomFilterExcludes(ParquetReaderScanState &state, ColumnReader &column_reader, const TableFilter &filter);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
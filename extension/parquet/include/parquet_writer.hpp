@@ -19,6 +19,7 @@
 #endif
 
 #include "column_writer.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_types.h"
 #include "thrift/protocol/TCompactProtocol.h"
 
@@ -30,12 +31,33 @@ class ParquetEncryptionConfig;
 class Serializer;
 class Deserializer;
 
+//! The version of the Parquet format that is written. V2 allows the writer to use the DELTA_BINARY_PACKED,
+//! DELTA_LENGTH_BYTE_ARRAY, DELTA_BYTE_ARRAY and BYTE_STREAM_SPLIT encodings, which older readers might not support.
+enum class ParquetVersion : uint8_t { V1 = 1, V2 = 2 };
+
 struct PreparedRowGroup {
 	duckdb_parquet::format::RowGroup row_group;
 	vector<unique_ptr<ColumnWriterState>> states;
 	vector<shared_ptr<StringHeap>> heaps;
 };
 
+//! The page index of a column chunk, which is written right before the footer of the file
+struct ParquetPageIndex {
+	idx_t row_group_idx = 0;
+	idx_t column_idx = 0;
+	//! Whether or not a ColumnIndex could be created (i.e. whether or not there are statistics for every page)
+	bool has_column_index = false;
+	duckdb_parquet::format::ColumnIndex column_index;
+	duckdb_parquet::format::OffsetIndex offset_index;
+};
+
+//! The bloom filter of a column chunk, which is written right before the page indexes of the file
+struct ParquetColumnBloomFilter {
+	idx_t row_group_idx = 0;
+	idx_t column_idx = 0;
+	unique_ptr<ParquetBloomFilter> bloom_filter;
+};
+
 struct FieldID;
 struct ChildFieldIDs {
 	ChildFieldIDs();
@@ -64,10 +86,13 @@ public:
 	ParquetWriter(FileSystem &fs, string file_name, vector<LogicalType> types, vector<string> names,
 	              duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
-	              shared_ptr<ParquetEncryptionConfig> encryption_config);
+	              shared_ptr<ParquetEncryptionConfig> encryption_config, const vector<idx_t> &bloom_filter_columns,
+	              ParquetVersion parquet_version);
 
 public:
+	//! Encodes and compresses a row group, this can be called by multiple threads in parallel
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
+	//! Appends a prepared row group to the file
 	void FlushRowGroup(PreparedRowGroup &row_group);
 	void Flush(ColumnDataCollection &buffer);
 	void Finalize();
@@ -81,6 +106,9 @@ public:
 	duckdb_parquet::format::CompressionCodec::type GetCodec() {
 		return codec;
 	}
+	ParquetVersion GetParquetVersion() const {
+		return parquet_version;
+	}
 	duckdb_parquet::format::Type::type GetType(idx_t schema_idx) {
 		return file_meta_data.schema[schema_idx].type;
 	}
@@ -97,7 +125,15 @@ public:
 	uint32_t Write(const duckdb_apache::thrift::TBase &object);
 	uint32_t WriteData(const const_data_ptr_t buffer, const uint32_t buffer_size);
 
+	//! Adds the page index of a column chunk of the row group that is currently being flushed
+	void AddPageIndex(unique_ptr<ParquetPageIndex> page_index);
+	//! Adds the bloom filter of a column chunk of the row group that is currently being flushed
+	void AddBloomFilter(idx_t column_idx, unique_ptr<ParquetBloomFilter> bloom_filter);
+
 private:
+	void WriteBloomFilters();
+	void WritePageIndexes();
+
 	static CopyTypeSupport DuckDBTypeToParquetTypeInternal(const LogicalType &duckdb_type,
 	                                                       duckdb_parquet::format::Type::type &type);
 	string file_name;
@@ -106,6 +142,7 @@ private:
 	duckdb_parquet::format::CompressionCodec::type codec;
 	ChildFieldIDs field_ids;
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
+	ParquetVersion parquet_version;
 
 	unique_ptr<BufferedFileWriter> writer;
 	shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
@@ -113,6 +150,8 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	vector<unique_ptr<ParquetPageIndex>> page_indexes;
+	vector<ParquetColumnBloomFilter> bloom_filters;
 };
 
 } // namespace duckdb
@@ -11,8 +11,25 @@
 #include "column_reader.hpp"
 #include "templated_column_reader.hpp"
 
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/map.hpp"
+#endif
+
 namespace duckdb {
 
+//! The fields of a STRUCT column that are used by a query. The fields that are not used are not read, they are
+//! emitted as NULL instead.
+struct ParquetStructProjection {
+	//! Whether or not all fields are used
+	bool all_fields = false;
+	//! The projections of the used fields, indexed by their field index (only if not all fields are used)
+	map<idx_t, ParquetStructProjection> fields;
+
+public:
+	//! Marks the field at the given path (a sequence of field indexes) as used
+	void AddPath(const vector<idx_t> &path, idx_t depth = 0);
+};
+
 class StructColumnReader : public ColumnReader {
 public:
 	static constexpr const PhysicalType TYPE = PhysicalType::STRUCT;
@@ -25,6 +42,8 @@ public:
 
 public:
 	ColumnReader *GetChildReader(idx_t child_idx);
+	//! Only reads the fields that are used by the projection
+	void ApplyProjection(const ParquetStructProjection &projection);
 
 	void InitializeRead(idx_t row_group_idx_p, const vector<ColumnChunk> &columns, TProtocol &protocol_p) override;
 
@@ -35,6 +54,18 @@ public:
 	idx_t GroupRowsAvailable() override;
 	uint64_t TotalCompressedSize() override;
 	void RegisterPrefetch(ThriftFileTransport &transport, bool allow_merge) override;
+	bool CanSkipWithPageIndex() const override {
+		return false;
+	}
+
+private:
+	bool ReadsChild(idx_t child_idx) const {
+		return read_children.empty() || read_children[child_idx];
+	}
+
+private:
+	//! The children that are read, if empty all children are read
+	vector<bool> read_children;
 };
 
 } // namespace duckdb
@@ -1,4 +1,5 @@
 #pragma once
+#include <condition_variable>
 #include <list>
 #include "thrift/protocol/TCompactProtocol.h"
 #include "thrift/transport/TBufferTransports.h"
@@ -7,6 +8,9 @@
 #ifndef DUCKDB_AMALGAMATION
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/thread.hpp"
 #endif
 
 namespace duckdb {
@@ -21,6 +25,8 @@ struct ReadHead {
 	// Current info
 	AllocatedData data;
 	bool data_isset = false;
+	// When the read head is fetched concurrently: which of its pieces have been fetched (protected by the buffer lock)
+	vector<bool> fetched_pieces;
 
 	idx_t GetEnd() const {
 		return size + location;
@@ -47,12 +53,49 @@ struct ReadHeadComparator {
 	}
 };
 
+// Additional handles to a file that are used to fetch ranges concurrently, the handles are opened on first use
+struct ConcurrentFetchHandles {
+	ConcurrentFetchHandles(FileSystem &fs, string path_p, FileOpenFlags flags, idx_t max_concurrent_fetches)
+	    : fs(fs), path(std::move(path_p)), flags(flags), max_concurrent_fetches(max_concurrent_fetches) {
+	}
+
+	FileSystem &fs;
+	string path;
+	FileOpenFlags flags;
+	// The maximum number of ranges that are fetched at the same time
+	idx_t max_concurrent_fetches;
+	vector<unique_ptr<FileHandle>> handles;
+
+	FileHandle &GetHandle(idx_t handle_idx) {
+		D_ASSERT(handle_idx < max_concurrent_fetches);
+		while (handles.size() <= handle_idx) {
+			handles.push_back(fs.OpenFile(path, flags));
+		}
+		return *handles[handle_idx];
+	}
+};
+
+// A piece of a read head that is fetched by a single request
+struct ReadHeadPiece {
+	ReadHead *read_head;
+	idx_t piece_idx;
+};
+
 // Two-step read ahead buffer
 // 1: register all ranges that will be read, merging ranges that are consecutive
 // 2: prefetch all registered ranges
+// If concurrent fetch handles are set, the registered ranges are split into pieces which are fetched in the background
+// with a bounded number of requests in flight, in the order of their location. Reads only wait for the pieces they
+// need, so the first ranges can be decoded while the rest are still being fetched.
 struct ReadAheadBuffer {
+	// Maximum size of a single request when fetching concurrently
+	static constexpr idx_t FETCH_PIECE_SIZE = 1 << 22; // 4 MiB
+
 	ReadAheadBuffer(Allocator &allocator, FileHandle &handle) : allocator(allocator), handle(handle) {
 	}
+	~ReadAheadBuffer() {
+		StopFetching();
+	}
 
 	// The list of read heads
 	std::list<ReadHead> read_heads;
@@ -103,19 +146,147 @@ struct ReadAheadBuffer {
 		return nullptr;
 	}
 
-	// Prefetch all read heads
+	// Prefetch all read heads that have not been fetched yet
 	void Prefetch() {
+		vector<ReadHead *> to_fetch;
 		for (auto &read_head : read_heads) {
-			read_head.Allocate(allocator);
-
+			if (read_head.data_isset || !read_head.fetched_pieces.empty()) {
+				continue;
+			}
 			if (read_head.GetEnd() > handle.GetFileSize()) {
 				throw std::runtime_error("Prefetch registered requested for bytes outside file");
 			}
+			read_head.Allocate(allocator);
+			to_fetch.push_back(&read_head);
+		}
+		if (to_fetch.empty()) {
+			return;
+		}
+		if (!fetch_handles || (to_fetch.size() == 1 && to_fetch[0]->size <= FETCH_PIECE_SIZE)) {
+			// a single request: nothing to do concurrently
+			for (auto read_head : to_fetch) {
+				handle.Read(read_head->data.get(), read_head->size, read_head->location);
+				read_head->data_isset = true;
+			}
+			return;
+		}
+		vector<ReadHeadPiece> new_pieces;
+		for (auto read_head : to_fetch) {
+			auto piece_count = MaxValue<idx_t>((read_head->size + FETCH_PIECE_SIZE - 1) / FETCH_PIECE_SIZE, 1);
+			read_head->fetched_pieces.resize(piece_count, false);
+			for (idx_t piece_idx = 0; piece_idx < piece_count; piece_idx++) {
+				new_pieces.push_back(ReadHeadPiece {read_head, piece_idx});
+			}
+		}
+		// fetch the pieces in the order in which they are read
+		std::sort(new_pieces.begin(), new_pieces.end(), [](const ReadHeadPiece &a, const ReadHeadPiece &b) {
+			return a.read_head->location + a.piece_idx * FETCH_PIECE_SIZE <
+			       b.read_head->location + b.piece_idx * FETCH_PIECE_SIZE;
+		});
+		// the pieces of a previous prefetch might still be needed, so they are not cancelled
+		WaitForFetches();
+		pieces = std::move(new_pieces);
+		next_piece = 0;
+#ifndef DUCKDB_NO_THREADS
+		auto thread_count = MinValue<idx_t>(fetch_handles->max_concurrent_fetches, pieces.size());
+		for (idx_t thread_idx = 0; thread_idx < thread_count; thread_idx++) {
+			auto &fetch_handle = fetch_handles->GetHandle(thread_idx);
+			fetch_threads.emplace_back([this, &fetch_handle]() { FetchPieces(fetch_handle); });
+		}
+#else
+		FetchPieces(handle);
+#endif
+	}
+
+	// Wait until the bytes [offset, offset + len) of a read head that is fetched concurrently are available
+	void WaitForFetch(ReadHead &read_head, idx_t offset, idx_t len) {
+		D_ASSERT(!read_head.fetched_pieces.empty() && len > 0);
+		auto first_piece = offset / FETCH_PIECE_SIZE;
+		auto last_piece = (offset + len - 1) / FETCH_PIECE_SIZE;
+		unique_lock<mutex> guard(lock);
+		fetch_done.wait(guard, [&]() {
+			if (error.HasError()) {
+				return true;
+			}
+			for (idx_t piece_idx = first_piece; piece_idx <= last_piece; piece_idx++) {
+				if (!read_head.fetched_pieces[piece_idx]) {
+					return false;
+				}
+			}
+			return true;
+		});
+		if (error.HasError()) {
+			error.Throw();
+		}
+	}
+
+	// Wait until all pieces have been fetched
+	void WaitForFetches() {
+		for (auto &fetch_thread : fetch_threads) {
+			fetch_thread.join();
+		}
+		fetch_threads.clear();
+		pieces.clear();
+		next_piece = 0;
+	}
 
-			handle.Read(read_head.data.get(), read_head.size, read_head.location);
-			read_head.data_isset = true;
+	// Cancel the pieces that have not been requested yet, and wait for the requests that are in flight
+	void StopFetching() {
+		{
+			lock_guard<mutex> guard(lock);
+			next_piece = pieces.size();
 		}
+		WaitForFetches();
+	}
+
+	void Clear() {
+		StopFetching();
+		read_heads.clear();
+		merge_set.clear();
+		error = ErrorData();
 	}
+
+	// Handles used to fetch the read heads concurrently (if any)
+	optional_ptr<ConcurrentFetchHandles> fetch_handles;
+
+private:
+	void FetchPieces(FileHandle &fetch_handle) {
+		while (true) {
+			ReadHeadPiece piece;
+			{
+				lock_guard<mutex> guard(lock);
+				if (next_piece >= pieces.size() || error.HasError()) {
+					return;
+				}
+				piece = pieces[next_piece++];
+			}
+			auto &read_head = *piece.read_head;
+			auto offset = piece.piece_idx * FETCH_PIECE_SIZE;
+			auto size = MinValue<idx_t>(FETCH_PIECE_SIZE, read_head.size - offset);
+			ErrorData fetch_error;
+			try {
+				fetch_handle.Read(read_head.data.get() + offset, size, read_head.location + offset);
+			} catch (std::exception &ex) {
+				fetch_error = ErrorData(ex);
+			}
+			lock_guard<mutex> guard(lock);
+			if (fetch_error.HasError()) {
+				error = std::move(fetch_error);
+			} else {
+				read_head.fetched_pieces[piece.piece_idx] = true;
+			}
+			fetch_done.notify_all();
+		}
+	}
+
+	mutex lock;
+	std::condition_variable fetch_done;
+	vector<thread> fetch_threads;
+	// The pieces of the read heads that are fetched concurrently, and the next one to be requested
+	vector<ReadHeadPiece> pieces;
+	idx_t next_piece = 0;
+	// The error of a failed fetch, thrown by the read that needs the data
+	ErrorData error;
 };
 
 class ThriftFileTransport : public duckdb_apache::thrift::transport::TVirtualTransport<ThriftFileTransport> {
@@ -123,7 +294,7 @@ public:
 	static constexpr uint64_t PREFETCH_FALLBACK_BUFFERSIZE = 1000000;
 
 	ThriftFileTransport(Allocator &allocator, FileHandle &handle_p, bool prefetch_mode_p)
-	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(ReadAheadBuffer(allocator, handle_p)),
+	    : handle(handle_p), location(0), allocator(allocator), ra_buffer(allocator, handle_p),
 	      prefetch_mode(prefetch_mode_p) {
 	}
 
@@ -132,7 +303,11 @@ public:
 		if (prefetch_buffer != nullptr && location - prefetch_buffer->location + len <= prefetch_buffer->size) {
 			D_ASSERT(location - prefetch_buffer->location + len <= prefetch_buffer->size);
 
-			if (!prefetch_buffer->data_isset) {
+			if (!prefetch_buffer->fetched_pieces.empty()) {
+				if (len > 0) {
+					ra_buffer.WaitForFetch(*prefetch_buffer, location - prefetch_buffer->location, len);
+				}
+			} else if (!prefetch_buffer->data_isset) {
 				prefetch_buffer->Allocate(allocator);
 				handle.Read(prefetch_buffer->data.get(), prefetch_buffer->size, prefetch_buffer->location);
 				prefetch_buffer->data_isset = true;
@@ -143,6 +318,10 @@ public:
 				Prefetch(location, MinValue<uint64_t>(PREFETCH_FALLBACK_BUFFERSIZE, handle.GetFileSize() - location));
 				auto prefetch_buffer_fallback = ra_buffer.GetReadHead(location);
 				D_ASSERT(location - prefetch_buffer_fallback->location + len <= prefetch_buffer_fallback->size);
+				if (!prefetch_buffer_fallback->fetched_pieces.empty()) {
+					ra_buffer.WaitForFetch(*prefetch_buffer_fallback, location - prefetch_buffer_fallback->location,
+					                       len);
+				}
 				memcpy(buf, prefetch_buffer_fallback->data.get() + location - prefetch_buffer_fallback->location, len);
 			} else {
 				handle.Read(buf, len, location);
@@ -175,8 +354,12 @@ public:
 	}
 
 	void ClearPrefetch() {
-		ra_buffer.read_heads.clear();
-		ra_buffer.merge_set.clear();
+		ra_buffer.Clear();
+	}
+
+	// Fetch the registered ranges concurrently, using the given handles
+	void SetConcurrentFetchHandles(ConcurrentFetchHandles &fetch_handles) {
+		ra_buffer.fetch_handles = &fetch_handles;
 	}
 
 	void SetLocation(idx_t location_p) {
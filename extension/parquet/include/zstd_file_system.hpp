@@ -26,6 +26,11 @@ public:
 	unique_ptr<StreamWrapper> CreateStream() override;
 	idx_t InBufferSize() override;
 	idx_t OutBufferSize() override;
+
+	//! Finds the frames from the seek table of files in the zstd seekable format, or by walking over the frames
+	bool GetFrames(FileHandle &handle, vector<CompressedFrame> &frames) override;
+	idx_t DecompressFrame(const_data_ptr_t input, idx_t input_size, unsafe_unique_array<data_t> &output,
+	                      idx_t &output_capacity) override;
 };
 
 } // namespace duckdb
@@ -0,0 +1,240 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "thrift/protocol/TProtocol.h"
+#include "zstd/common/xxhash.h"
+
+#include <cmath>
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/types/date.hpp"
+#endif
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TProtocol;
+using duckdb_apache::thrift::protocol::TType;
+using duckdb_parquet::format::Type;
+
+static constexpr const uint32_t BLOOM_FILTER_SALT[ParquetBloomFilter::WORDS_PER_BLOCK] = {
+    0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_distinct_values, double false_positive_ratio) {
+	// the optimal number of bits for a split block bloom filter, see the Parquet specification
+	auto num_bits =
+	    -8.0 * double(MaxValue<idx_t>(num_distinct_values, 1)) / std::log(1 - std::pow(false_positive_ratio, 1.0 / 8));
+	auto num_bytes = MINIMUM_BYTES;
+	while (num_bytes < MAXIMUM_BYTES && double(num_bytes * 8) < num_bits) {
+		num_bytes *= 2;
+	}
+	words.resize(num_bytes / sizeof(uint32_t), 0);
+}
+
+ParquetBloomFilter::ParquetBloomFilter(vector<uint32_t> words_p) : words(std::move(words_p)) {
+	D_ASSERT(!words.empty() && words.size() % WORDS_PER_BLOCK == 0);
+}
+
+static inline idx_t BloomFilterBlockIndex(uint64_t hash, idx_t num_blocks) {
+	return NumericCast<idx_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+void ParquetBloomFilter::FilterInsert(uint64_t hash) {
+	auto block = words.data() + BloomFilterBlockIndex(hash, words.size() / WORDS_PER_BLOCK) * WORDS_PER_BLOCK;
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		block[i] |= 1U << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::FilterCheck(uint64_t hash) const {
+	auto block = words.data() + BloomFilterBlockIndex(hash, words.size() / WORDS_PER_BLOCK) * WORDS_PER_BLOCK;
+	auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < WORDS_PER_BLOCK; i++) {
+		if (!(block[i] & (1U << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t data, idx_t size) {
+	return duckdb_zstd::XXH64(data, size, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Serialization
+//===--------------------------------------------------------------------===//
+// The BloomFilterHeader is (de)serialized by hand as it is not part of the generated Thrift code. Its algorithm, hash
+// and compression are unions of which we only support (and write) the first field: BLOCK, XXHASH and UNCOMPRESSED.
+static void WriteUnionField(TProtocol &protocol, const char *name, int16_t field_id, const char *value_name) {
+	protocol.writeFieldBegin(name, TType::T_STRUCT, field_id);
+	protocol.writeStructBegin(name);
+	protocol.writeFieldBegin(value_name, TType::T_STRUCT, 1);
+	protocol.writeStructBegin(value_name);
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+	protocol.writeFieldEnd();
+}
+
+void ParquetBloomFilter::Write(TProtocol &protocol) const {
+	protocol.writeStructBegin("BloomFilterHeader");
+	protocol.writeFieldBegin("numBytes", TType::T_I32, 1);
+	protocol.writeI32(NumericCast<int32_t>(SizeInBytes()));
+	protocol.writeFieldEnd();
+	WriteUnionField(protocol, "algorithm", 2, "BLOCK");
+	WriteUnionField(protocol, "hash", 3, "XXHASH");
+	WriteUnionField(protocol, "compression", 4, "UNCOMPRESSED");
+	protocol.writeFieldStop();
+	protocol.writeStructEnd();
+
+	protocol.getTransport()->write(const_data_ptr_cast(words.data()), NumericCast<uint32_t>(SizeInBytes()));
+}
+
+//! Reads a union and returns the id of the field that is set
+static int16_t ReadUnionField(TProtocol &protocol) {
+	string name;
+	TType field_type;
+	int16_t field_id;
+	int16_t result = 0;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == TType::T_STOP) {
+			break;
+		}
+		result = field_id;
+		protocol.skip(field_type);
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+	return result;
+}
+
+unique_ptr<ParquetBloomFilter> ParquetBloomFilter::Read(TProtocol &protocol) {
+	string name;
+	TType field_type;
+	int16_t field_id;
+	int32_t num_bytes = 0;
+	bool supported = true;
+	protocol.readStructBegin(name);
+	while (true) {
+		protocol.readFieldBegin(name, field_type, field_id);
+		if (field_type == TType::T_STOP) {
+			break;
+		}
+		if (field_id == 1 && field_type == TType::T_I32) {
+			protocol.readI32(num_bytes);
+		} else if (field_id >= 2 && field_id <= 4 && field_type == TType::T_STRUCT) {
+			supported = ReadUnionField(protocol) == 1 && supported;
+		} else {
+			protocol.skip(field_type);
+		}
+		protocol.readFieldEnd();
+	}
+	protocol.readStructEnd();
+	if (!supported || num_bytes < int32_t(MINIMUM_BYTES) || num_bytes > int32_t(128 * MAXIMUM_BYTES) ||
+	    num_bytes % BLOCK_SIZE != 0) {
+		return nullptr;
+	}
+	vector<uint32_t> words(NumericCast<idx_t>(num_bytes) / sizeof(uint32_t));
+	protocol.getTransport()->readAll(data_ptr_cast(words.data()), NumericCast<uint32_t>(num_bytes));
+	return make_uniq<ParquetBloomFilter>(std::move(words));
+}
+
+//===--------------------------------------------------------------------===//
+// Types
+//===--------------------------------------------------------------------===//
+bool ParquetBloomFilter::TypeIsSupported(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool ParquetBloomFilter::TryHashConstant(const Value &constant, Type::type parquet_type, uint64_t &hash) {
+	if (constant.IsNull()) {
+		return false;
+	}
+	switch (constant.type().id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+		if (parquet_type != Type::INT32) {
+			return false;
+		}
+		hash = Hash<int32_t>(constant.GetValue<int32_t>());
+		return true;
+	case LogicalTypeId::UINTEGER:
+		if (parquet_type != Type::INT32) {
+			return false;
+		}
+		hash = Hash<uint32_t>(constant.GetValue<uint32_t>());
+		return true;
+	case LogicalTypeId::DATE:
+		if (parquet_type != Type::INT32) {
+			return false;
+		}
+		hash = Hash<int32_t>(constant.GetValue<date_t>().days);
+		return true;
+	case LogicalTypeId::BIGINT:
+		if (parquet_type != Type::INT64) {
+			return false;
+		}
+		hash = Hash<int64_t>(constant.GetValue<int64_t>());
+		return true;
+	case LogicalTypeId::UBIGINT:
+		if (parquet_type != Type::INT64) {
+			return false;
+		}
+		hash = Hash<uint64_t>(constant.GetValue<uint64_t>());
+		return true;
+	case LogicalTypeId::FLOAT: {
+		auto value = constant.GetValue<float>();
+		// -0.0 and 0.0 (and different NaNs) compare equal but are hashed differently
+		if (parquet_type != Type::FLOAT || value == 0 || Value::IsNan(value)) {
+			return false;
+		}
+		hash = Hash<float>(value);
+		return true;
+	}
+	case LogicalTypeId::DOUBLE: {
+		auto value = constant.GetValue<double>();
+		if (parquet_type != Type::DOUBLE || value == 0 || Value::IsNan(value)) {
+			return false;
+		}
+		hash = Hash<double>(value);
+		return true;
+	}
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::BLOB: {
+		if (parquet_type != Type::BYTE_ARRAY) {
+			return false;
+		}
+		auto &str = StringValue::Get(constant);
+		hash = Hash(const_data_ptr_cast(str.c_str()), str.size());
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
@@ -4,7 +4,9 @@
 
 #include "cast_column_reader.hpp"
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
+#include "parquet_manifest.hpp"
 #include "parquet_metadata.hpp"
 #include "parquet_reader.hpp"
 #include "parquet_writer.hpp"
@@ -31,11 +33,18 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/extension_util.hpp"
+#include "duckdb/optimizer/optimizer_extension.hpp"
 #include "duckdb/parser/expression/constant_expression.hpp"
 #include "duckdb/parser/expression/function_expression.hpp"
 #include "duckdb/parser/parsed_data/create_copy_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/filter/struct_filter.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/table/row_group.hpp"
@@ -59,6 +68,10 @@ struct ParquetReadBindData : public TableFunctionData {
 	idx_t initial_file_row_groups;
 	ParquetOptions parquet_options;
 	MultiFileReaderBindData reader_bind;
+	//! The manifest that is used to skip files, if any
+	shared_ptr<ParquetManifest> manifest;
+	//! The used fields of the STRUCT columns of which not all fields are used, indexed by column index
+	unordered_map<column_t, ParquetStructProjection> struct_projections;
 
 	void Initialize(shared_ptr<ParquetReader> reader) {
 		initial_reader = std::move(reader);
@@ -98,6 +111,10 @@ struct ParquetReadGlobalState : public GlobalTableFunctionState {
 	atomic<idx_t> file_index;
 	//! Index of row group within file currently up for scanning
 	idx_t row_group_index;
+	//! Large row groups are scanned in parts: the number of parts of the current row group (or 0 if not determined yet)
+	idx_t row_group_part_count;
+	//! Index of the part of the current row group up for scanning
+	idx_t row_group_part_index;
 	//! Batch index of the next row group to be scanned
 	idx_t batch_index;
 
@@ -131,6 +148,10 @@ struct ParquetWriteBindData : public TableFunctionData {
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
 
 	ChildFieldIDs field_ids;
+	//! The columns for which a bloom filter is written
+	vector<idx_t> bloom_filter_columns;
+	//! The version of the format, which determines the encodings the writer can choose from
+	ParquetVersion parquet_version = ParquetVersion::V1;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -202,9 +223,9 @@ static MultiFileReaderBindData BindSchema(ClientContext &context, vector<Logical
 	return bind_data;
 }
 
-static void InitializeParquetReader(ParquetReader &reader, const ParquetReadBindData &bind_data,
-                                    const vector<column_t> &global_column_ids,
-                                    optional_ptr<TableFilterSet> table_filters, ClientContext &context) {
+static void InitializeParquetReaderColumns(ParquetReader &reader, const ParquetReadBindData &bind_data,
+                                           const vector<column_t> &global_column_ids,
+                                           optional_ptr<TableFilterSet> table_filters, ClientContext &context) {
 	auto &parquet_options = bind_data.parquet_options;
 	auto &reader_data = reader.reader_data;
 	if (bind_data.parquet_options.schema.empty()) {
@@ -282,6 +303,31 @@ static void InitializeParquetReader(ParquetReader &reader, const ParquetReadBind
 	reader_data.filters = table_filters;
 }
 
+static void InitializeParquetReader(ParquetReader &reader, const ParquetReadBindData &bind_data,
+                                    const vector<column_t> &global_column_ids,
+                                    optional_ptr<TableFilterSet> table_filters, ClientContext &context) {
+	InitializeParquetReaderColumns(reader, bind_data, global_column_ids, table_filters, context);
+	if (bind_data.struct_projections.empty()) {
+		return;
+	}
+	// only read the used fields of struct columns, if the struct type in the file matches the one of the scan
+	auto &reader_data = reader.reader_data;
+	for (idx_t i = 0; i < reader_data.column_ids.size(); i++) {
+		auto global_column_index = global_column_ids[reader_data.column_mapping[i]];
+		auto entry = bind_data.struct_projections.find(global_column_index);
+		if (entry == bind_data.struct_projections.end()) {
+			continue;
+		}
+		auto file_column_index = reader_data.column_ids[i];
+		if (reader_data.cast_map.find(file_column_index) != reader_data.cast_map.end() ||
+		    file_column_index >= reader.GetTypes().size() ||
+		    reader.GetTypes()[file_column_index] != bind_data.types[global_column_index]) {
+			continue;
+		}
+		reader.struct_projections[file_column_index] = entry->second;
+	}
+}
+
 static bool GetBooleanArgument(const pair<string, vector<Value>> &option) {
 	if (option.second.empty()) {
 		return true;
@@ -311,6 +357,7 @@ public:
 		                                                                 {"type", LogicalType::VARCHAR},
 		                                                                 {"default_value", LogicalType::VARCHAR}}}));
 		table_function.named_parameters["encryption_config"] = LogicalTypeId::ANY;
+		table_function.named_parameters["manifest"] = LogicalType::VARCHAR;
 		MultiFileReader::AddParameters(table_function);
 		table_function.get_batch_index = ParquetScanGetBatchIndex;
 		table_function.serialize = ParquetScanSerialize;
@@ -446,6 +493,13 @@ public:
 			result->types = return_types;
 		}
 		result->parquet_options = parquet_options;
+		if (!parquet_options.manifest_path.empty()) {
+			result->manifest = ParquetManifest::Read(context, parquet_options.manifest_path);
+		} else {
+			// read the footers of all files up front, so the scan (and the statistics) can use the object cache
+			ParquetMetadataProvider metadata_provider(context);
+			metadata_provider.Prefetch(result->files, parquet_options.encryption_config);
+		}
 		return std::move(result);
 	}
 
@@ -479,6 +533,8 @@ public:
 				parquet_options.file_options.auto_detect_hive_partitioning = false;
 			} else if (loption == "encryption_config") {
 				parquet_options.encryption_config = ParquetEncryptionConfig::Create(context, kv.second);
+			} else if (loption == "manifest") {
+				parquet_options.manifest_path = StringValue::Get(kv.second);
 			}
 		}
 		parquet_options.file_options.AutoDetectHivePartitioning(files, context);
@@ -555,6 +611,8 @@ public:
 		result->column_ids = input.column_ids;
 		result->filters = input.filters.get();
 		result->row_group_index = 0;
+		result->row_group_part_count = 0;
+		result->row_group_part_index = 0;
 		result->file_index = 0;
 		result->batch_index = 0;
 		result->max_threads = ParquetScanMaxThreads(context, input.bind_data.get());
@@ -628,6 +686,10 @@ public:
 
 	static unique_ptr<NodeStatistics> ParquetCardinality(ClientContext &context, const FunctionData *bind_data) {
 		auto &data = bind_data->Cast<ParquetReadBindData>();
+		idx_t row_count;
+		if (data.manifest && data.manifest->TryGetRowCount(data.files, row_count)) {
+			return make_uniq<NodeStatistics>(row_count);
+		}
 		return make_uniq<NodeStatistics>(data.initial_file_cardinality * data.files.size());
 	}
 
@@ -636,7 +698,21 @@ public:
 		if (data.files.size() > 1) {
 			return TaskScheduler::GetScheduler(context).NumberOfThreads();
 		}
-		return MaxValue(data.initial_file_row_groups, (idx_t)1);
+		// large row groups can be split into parts that are scanned in parallel
+		auto max_group_parts = data.initial_file_cardinality / ParquetReaderScanConfig::MINIMUM_GROUP_PART_ROWS;
+		return MaxValue(MaxValue(data.initial_file_row_groups, max_group_parts), (idx_t)1);
+	}
+
+	//! Determines in how many parts a row group is scanned, only large row groups of which all scanned columns can jump
+	//! to a row using the page index are split up
+	static idx_t ParquetGroupPartCount(ClientContext &context, ParquetReader &reader, idx_t group_idx) {
+		auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+		auto part_count = MinValue<idx_t>(
+		    num_threads, reader.NumGroupRows(group_idx) / ParquetReaderScanConfig::MINIMUM_GROUP_PART_ROWS);
+		if (part_count <= 1 || !reader.CanScanGroupInParts(group_idx)) {
+			return 1;
+		}
+		return part_count;
 	}
 
 	// This function looks for the next available row group. If not available, it will open files from bind_data.files
@@ -661,11 +737,31 @@ public:
 				    parallel_state.readers[parallel_state.file_index]->NumRowGroups()) {
 					// The current reader has rowgroups left to be scanned
 					scan_data.reader = parallel_state.readers[parallel_state.file_index];
-					vector<idx_t> group_indexes {parallel_state.row_group_index};
-					scan_data.reader->InitializeScan(scan_data.scan_state, group_indexes);
+					auto group_idx = parallel_state.row_group_index;
+					if (parallel_state.row_group_part_count == 0) {
+						parallel_state.row_group_part_count =
+						    ParquetGroupPartCount(context, *scan_data.reader, group_idx);
+					}
+					auto part_count = parallel_state.row_group_part_count;
+					if (part_count == 1) {
+						vector<idx_t> group_indexes {group_idx};
+						scan_data.reader->InitializeScan(scan_data.scan_state, group_indexes);
+					} else {
+						// every part gets its own batch index, so the insertion order is preserved
+						auto group_rows = scan_data.reader->NumGroupRows(group_idx);
+						auto part_idx = parallel_state.row_group_part_index;
+						auto row_start = group_rows * part_idx / part_count;
+						auto row_end = group_rows * (part_idx + 1) / part_count;
+						scan_data.reader->InitializeScan(scan_data.scan_state, group_idx, row_start, row_end);
+					}
 					scan_data.batch_index = parallel_state.batch_index++;
 					scan_data.file_index = parallel_state.file_index;
-					parallel_state.row_group_index++;
+					parallel_state.row_group_part_index++;
+					if (parallel_state.row_group_part_index == part_count) {
+						parallel_state.row_group_index++;
+						parallel_state.row_group_part_count = 0;
+						parallel_state.row_group_part_index = 0;
+					}
 					return true;
 				} else {
 					// Close current file
@@ -700,6 +796,10 @@ public:
 
 		auto reset_reader = MultiFileReader::ComplexFilterPushdown(context, data.files,
 		                                                           data.parquet_options.file_options, get, filters);
+		if (data.manifest && data.manifest->PruneFiles(data.files, get, filters)) {
+			// skip the files that cannot contain any rows that pass the filters according to the manifest
+			reset_reader = true;
+		}
 		if (reset_reader) {
 			MultiFileReader::PruneReaders(data);
 		}
@@ -923,6 +1023,40 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 	auto bind_data = make_uniq<ParquetWriteBindData>();
 	for (auto &option : input.info.options) {
 		const auto loption = StringUtil::Lower(option.first);
+		if (loption == "bloom_filter_columns") {
+			// accepts a list of column names, e.g. BLOOM_FILTER_COLUMNS (a, b) or BLOOM_FILTER_COLUMNS ['a', 'b']
+			vector<Value> column_names;
+			for (auto &value : option.second) {
+				if (value.type().id() == LogicalTypeId::LIST) {
+					auto &children = ListValue::GetChildren(value);
+					column_names.insert(column_names.end(), children.begin(), children.end());
+				} else {
+					column_names.push_back(value);
+				}
+			}
+			for (auto &column_name : column_names) {
+				auto name = column_name.ToString();
+				idx_t col_idx;
+				for (col_idx = 0; col_idx < names.size(); col_idx++) {
+					if (StringUtil::CIEquals(names[col_idx], name)) {
+						break;
+					}
+				}
+				if (col_idx == names.size()) {
+					throw BinderException("Column \"%s\" in BLOOM_FILTER_COLUMNS does not exist", name);
+				}
+				if (!ParquetBloomFilter::TypeIsSupported(sql_types[col_idx])) {
+					throw BinderException("Bloom filters are not supported for column \"%s\" of type %s", name,
+					                      sql_types[col_idx].ToString());
+				}
+				auto &bloom_filter_columns = bind_data->bloom_filter_columns;
+				if (std::find(bloom_filter_columns.begin(), bloom_filter_columns.end(), col_idx) ==
+				    bloom_filter_columns.end()) {
+					bloom_filter_columns.push_back(col_idx);
+				}
+			}
+			continue;
+		}
 		if (option.second.size() != 1) {
 			// All parquet write options require exactly one argument
 			throw BinderException("%s requires exactly one argument", StringUtil::Upper(loption));
@@ -992,6 +1126,15 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			}
 		} else if (loption == "encryption_config") {
 			bind_data->encryption_config = ParquetEncryptionConfig::Create(context, option.second[0]);
+		} else if (loption == "parquet_version") {
+			const auto roption = StringUtil::Upper(option.second[0].ToString());
+			if (roption == "V1" || roption == "1") {
+				bind_data->parquet_version = ParquetVersion::V1;
+			} else if (roption == "V2" || roption == "2") {
+				bind_data->parquet_version = ParquetVersion::V2;
+			} else {
+				throw BinderException("Expected %s argument to be either [V1 or V2]", loption);
+			}
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
@@ -1019,7 +1162,8 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	auto &fs = FileSystem::GetFileSystem(context);
 	global_state->writer = make_uniq<ParquetWriter>(fs, file_path, parquet_bind.sql_types, parquet_bind.column_names,
 	                                                parquet_bind.codec, parquet_bind.field_ids.Copy(),
-	                                                parquet_bind.kv_metadata, parquet_bind.encryption_config);
+	                                                parquet_bind.kv_metadata, parquet_bind.encryption_config,
+	                                                parquet_bind.bloom_filter_columns, parquet_bind.parquet_version);
 	return std::move(global_state);
 }
 
@@ -1126,6 +1270,29 @@ EnumUtil::FromString<duckdb_parquet::format::CompressionCodec::type>(const char
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template <>
+const char *EnumUtil::ToChars<ParquetVersion>(ParquetVersion value) {
+	switch (value) {
+	case ParquetVersion::V1:
+		return "V1";
+	case ParquetVersion::V2:
+		return "V2";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+	}
+}
+
+template <>
+ParquetVersion EnumUtil::FromString<ParquetVersion>(const char *value) {
+	if (StringUtil::Equals(value, "V1")) {
+		return ParquetVersion::V1;
+	}
+	if (StringUtil::Equals(value, "V2")) {
+		return ParquetVersion::V2;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bind_data_p,
                                  const CopyFunction &function) {
 	auto &bind_data = bind_data_p.Cast<ParquetWriteBindData>();
@@ -1138,6 +1305,9 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WriteProperty(106, "field_ids", bind_data.field_ids);
 	serializer.WritePropertyWithDefault<shared_ptr<ParquetEncryptionConfig>>(107, "encryption_config",
 	                                                                         bind_data.encryption_config, nullptr);
+	serializer.WritePropertyWithDefault<vector<idx_t>>(108, "bloom_filter_columns", bind_data.bloom_filter_columns);
+	serializer.WritePropertyWithDefault<ParquetVersion>(109, "parquet_version", bind_data.parquet_version,
+	                                                    ParquetVersion::V1);
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1151,6 +1321,9 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	data->field_ids = deserializer.ReadProperty<ChildFieldIDs>(106, "field_ids");
 	deserializer.ReadPropertyWithDefault<shared_ptr<ParquetEncryptionConfig>>(107, "encryption_config",
 	                                                                          data->encryption_config, nullptr);
+	deserializer.ReadPropertyWithDefault<vector<idx_t>>(108, "bloom_filter_columns", data->bloom_filter_columns);
+	deserializer.ReadPropertyWithDefault<ParquetVersion>(109, "parquet_version", data->parquet_version,
+	                                                     ParquetVersion::V1);
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
@@ -1230,6 +1403,199 @@ unique_ptr<TableRef> ParquetScanReplacement(ClientContext &context, const string
 	return std::move(table_function);
 }
 
+//===--------------------------------------------------------------------===//
+// Struct Projection Pushdown
+//===--------------------------------------------------------------------===//
+//! Determines which fields of the STRUCT columns of Parquet scans are used by a plan. A field is used if it is
+//! extracted with struct_extract (directly on top of the column, or on top of an extracted field), or if a pushed down
+//! filter refers to it. Any other reference to a column uses all of its fields, this includes the columns that are
+//! emitted by the plan and the columns that operators such as set operations consume by position.
+class ParquetStructProjectionOptimizer : public LogicalOperatorVisitor {
+public:
+	static void Optimize(ClientContext &context, OptimizerExtensionInfo *info, unique_ptr<LogicalOperator> &plan) {
+		ParquetStructProjectionOptimizer optimizer;
+		optimizer.AddPositionalReferences(*plan);
+		optimizer.VisitOperator(*plan);
+		optimizer.PushdownProjections();
+	}
+
+	void VisitOperator(LogicalOperator &op) override {
+		if (op.type == LogicalOperatorType::LOGICAL_GET) {
+			auto &get = op.Cast<LogicalGet>();
+			if (get.function.function == ParquetScanFunction::ParquetScanImplementation && get.bind_data) {
+				gets.push_back(get);
+			}
+		}
+		if (!ReferencesColumnsByExpression(op)) {
+			for (auto &child : op.children) {
+				AddPositionalReferences(*child);
+			}
+		}
+		LogicalOperatorVisitor::VisitOperator(op);
+	}
+
+	void VisitExpression(unique_ptr<Expression> *expression) override {
+		VisitStructExpression(**expression);
+	}
+
+private:
+	struct ColumnReference {
+		bool operator<(const ColumnReference &other) const {
+			return table_index < other.table_index ||
+			       (table_index == other.table_index && column_index < other.column_index);
+		}
+
+		idx_t table_index;
+		idx_t column_index;
+	};
+
+	//! Checks if the expression is a column reference, or a chain of struct_extract calls on top of one
+	static bool TryGetStructPath(Expression &expr, ColumnBinding &binding, vector<idx_t> &path) {
+		if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
+			binding = expr.Cast<BoundColumnRefExpression>().binding;
+			return true;
+		}
+		if (expr.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+			return false;
+		}
+		auto &function = expr.Cast<BoundFunctionExpression>();
+		if (function.function.name != "struct_extract" || function.children.size() != 2 ||
+		    function.children[0]->return_type.id() != LogicalTypeId::STRUCT ||
+		    function.children[1]->type != ExpressionType::VALUE_CONSTANT) {
+			return false;
+		}
+		auto &key = function.children[1]->Cast<BoundConstantExpression>().value;
+		if (key.IsNull() || key.type().id() != LogicalTypeId::VARCHAR) {
+			return false;
+		}
+		auto &child_types = StructType::GetChildTypes(function.children[0]->return_type);
+		auto key_name = StringUtil::Lower(StringValue::Get(key));
+		for (idx_t child_idx = 0; child_idx < child_types.size(); child_idx++) {
+			if (StringUtil::Lower(child_types[child_idx].first) != key_name) {
+				continue;
+			}
+			if (!TryGetStructPath(*function.children[0], binding, path)) {
+				return false;
+			}
+			path.push_back(child_idx);
+			return true;
+		}
+		return false;
+	}
+
+	//! Whether or not the operator only refers to the columns of its children through its expressions
+	static bool ReferencesColumnsByExpression(LogicalOperator &op) {
+		switch (op.type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION:
+		case LogicalOperatorType::LOGICAL_FILTER:
+		case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
+		case LogicalOperatorType::LOGICAL_WINDOW:
+		case LogicalOperatorType::LOGICAL_UNNEST:
+		case LogicalOperatorType::LOGICAL_ORDER_BY:
+		case LogicalOperatorType::LOGICAL_TOP_N:
+		case LogicalOperatorType::LOGICAL_LIMIT:
+		case LogicalOperatorType::LOGICAL_SAMPLE:
+		case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+		case LogicalOperatorType::LOGICAL_ANY_JOIN:
+		case LogicalOperatorType::LOGICAL_ASOF_JOIN:
+		case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
+		case LogicalOperatorType::LOGICAL_POSITIONAL_JOIN:
+			// these operators pass on the columns of their children: the parent decides how they are referenced
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	//! Marks all fields of the columns that are emitted by the operator as used
+	void AddPositionalReferences(LogicalOperator &op) {
+		for (auto &binding : op.GetColumnBindings()) {
+			references[ColumnReference {binding.table_index, binding.column_index}].AddPath(vector<idx_t>());
+		}
+	}
+
+	void VisitStructExpression(Expression &expr) {
+		ColumnBinding binding;
+		vector<idx_t> path;
+		if (TryGetStructPath(expr, binding, path)) {
+			references[ColumnReference {binding.table_index, binding.column_index}].AddPath(path);
+			return;
+		}
+		ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { VisitStructExpression(child); });
+	}
+
+	static void AddFilterPaths(const TableFilter &filter, vector<idx_t> &path, ParquetStructProjection &projection) {
+		switch (filter.filter_type) {
+		case TableFilterType::STRUCT_EXTRACT: {
+			auto &struct_filter = filter.Cast<StructFilter>();
+			path.push_back(struct_filter.child_idx);
+			AddFilterPaths(*struct_filter.child_filter, path, projection);
+			path.pop_back();
+			break;
+		}
+		case TableFilterType::CONJUNCTION_AND:
+			for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+				AddFilterPaths(*child_filter, path, projection);
+			}
+			break;
+		case TableFilterType::CONJUNCTION_OR:
+			for (auto &child_filter : filter.Cast<ConjunctionOrFilter>().child_filters) {
+				AddFilterPaths(*child_filter, path, projection);
+			}
+			break;
+		default:
+			projection.AddPath(path);
+			break;
+		}
+	}
+
+	void PushdownProjections() {
+		for (auto &get_ref : gets) {
+			auto &get = get_ref.get();
+			auto &bind_data = get.bind_data->Cast<ParquetReadBindData>();
+			for (idx_t i = 0; i < get.column_ids.size(); i++) {
+				auto column_id = get.column_ids[i];
+				if (IsRowIdColumnId(column_id) || column_id >= bind_data.types.size() ||
+				    bind_data.types[column_id].id() != LogicalTypeId::STRUCT) {
+					continue;
+				}
+				ParquetStructProjection projection;
+				bool projected = get.projection_ids.empty() ||
+				                 std::find(get.projection_ids.begin(), get.projection_ids.end(), i) !=
+				                     get.projection_ids.end();
+				if (projected) {
+					auto entry = references.find(ColumnReference {get.table_index, i});
+					if (entry == references.end()) {
+						// the column is not referenced by any expression, e.g. because it is passed on as-is
+						continue;
+					}
+					projection = entry->second;
+				}
+				// the filters of the logical get are keyed by column id
+				auto filter = get.table_filters.filters.find(column_id);
+				if (filter != get.table_filters.filters.end()) {
+					vector<idx_t> path;
+					AddFilterPaths(*filter->second, path, projection);
+				}
+				if (projection.all_fields || projection.fields.empty()) {
+					continue;
+				}
+				bind_data.struct_projections[column_id] = std::move(projection);
+			}
+		}
+	}
+
+private:
+	vector<reference<LogicalGet>> gets;
+	map<ColumnReference, ParquetStructProjection> references;
+};
+
+static constexpr const char *DEFAULT_PARQUET_METADATA_CACHE_SIZE = "512MB";
+
+static void SetParquetMetadataCacheSize(ClientContext &context, SetScope scope, Value &parameter) {
+	ObjectCache::GetObjectCache(context).SetMaxMemory(DBConfig::ParseMemoryLimit(parameter.ToString()));
+}
+
 void ParquetExtension::Load(DuckDB &db) {
 	auto &db_instance = *db.instance;
 	auto &fs = db.GetFileSystem();
@@ -1257,6 +1623,9 @@ void ParquetExtension::Load(DuckDB &db) {
 	ParquetFileMetadataFunction file_meta_fun;
 	ExtensionUtil::RegisterFunction(db_instance, MultiFileReader::CreateFunctionSet(file_meta_fun));
 
+	// parquet_build_manifest
+	ExtensionUtil::RegisterFunction(db_instance, ParquetBuildManifestFunction::GetFunctionSet());
+
 	CopyFunction function("parquet");
 	function.copy_to_bind = ParquetWriteBind;
 	function.copy_to_initialize_global = ParquetWriteInitializeGlobal;
@@ -1285,8 +1654,27 @@ void ParquetExtension::Load(DuckDB &db) {
 
 	auto &config = DBConfig::GetConfig(*db.instance);
 	config.replacement_scans.emplace_back(ParquetScanReplacement);
+	OptimizerExtension struct_projection_optimizer;
+	struct_projection_optimizer.optimize_function = ParquetStructProjectionOptimizer::Optimize;
+	config.optimizer_extensions.push_back(std::move(struct_projection_optimizer));
 	config.AddExtensionOption("binary_as_string", "In Parquet files, interpret binary data as a string.",
 	                          LogicalType::BOOLEAN);
+	config.AddExtensionOption("prefetch_all_parquet_files",
+	                          "Use the prefetching mechanism for all types of parquet files, not only for remote ones.",
+	                          LogicalType::BOOLEAN, Value(false));
+	config.AddExtensionOption("parquet_metadata_cache_size",
+	                          "The maximum memory used by the cached metadata of Parquet files in the object cache.",
+	                          LogicalType::VARCHAR, Value(DEFAULT_PARQUET_METADATA_CACHE_SIZE),
+	                          SetParquetMetadataCacheSize);
+	config.AddExtensionOption("parquet_metadata_cache_directory",
+	                          "A directory in which the footers of Parquet files are cached across restarts (disabled "
+	                          "if empty).",
+	                          LogicalType::VARCHAR, Value(""));
+	config.AddExtensionOption("parquet_metadata_prefetch_threads",
+	                          "The number of threads that read the footers of multi-file Parquet scans up front when "
+	                          "the object cache is enabled (0 to disable).",
+	                          LogicalType::UBIGINT, Value::UBIGINT(8));
+	db.instance->GetObjectCache().SetMaxMemory(DBConfig::ParseMemoryLimit(DEFAULT_PARQUET_METADATA_CACHE_SIZE));
 }
 
 std::string ParquetExtension::Name() {
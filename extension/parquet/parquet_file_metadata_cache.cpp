@@ -0,0 +1,322 @@
+#include "parquet_file_metadata_cache.hpp"
+
+#include "parquet_crypto.hpp"
+#include "resizable_buffer.hpp"
+#include "thrift_tools.hpp"
+
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/thread.hpp"
+#include "duckdb/common/types/uuid.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include <thrift/transport/TBufferTransports.h>
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TCompactProtocolT;
+using duckdb_apache::thrift::transport::TMemoryBuffer;
+using duckdb_parquet::format::FileCryptoMetaData;
+using duckdb_parquet::format::FileMetaData;
+
+idx_t ParquetFileMetadataCache::EstimateSize(const FileMetaData &metadata) {
+	idx_t size = sizeof(FileMetaData) + metadata.created_by.size();
+	for (auto &schema_element : metadata.schema) {
+		size += sizeof(schema_element) + schema_element.name.size();
+	}
+	for (auto &key_value : metadata.key_value_metadata) {
+		size += sizeof(key_value) + key_value.key.size() + key_value.value.size();
+	}
+	for (auto &row_group : metadata.row_groups) {
+		size += sizeof(row_group);
+		for (auto &column_chunk : row_group.columns) {
+			size += sizeof(column_chunk) + column_chunk.file_path.size();
+			auto &column_metadata = column_chunk.meta_data;
+			for (auto &path_element : column_metadata.path_in_schema) {
+				size += sizeof(path_element) + path_element.size();
+			}
+			size += column_metadata.encodings.size() * sizeof(column_metadata.encodings[0]);
+			size += column_metadata.encoding_stats.size() * sizeof(column_metadata.encoding_stats[0]);
+			auto &statistics = column_metadata.statistics;
+			size += statistics.min.size() + statistics.max.size() + statistics.min_value.size() +
+			        statistics.max_value.size();
+		}
+	}
+	return size;
+}
+
+static shared_ptr<ParquetFileMetadataCache>
+LoadMetadata(Allocator &allocator, FileHandle &file_handle,
+             const shared_ptr<const ParquetEncryptionConfig> &encryption_config, AllocatedData *footer_data = nullptr) {
+	auto current_time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+
+	auto file_proto = make_uniq<TCompactProtocolT<ThriftFileTransport>>(
+	    make_shared<ThriftFileTransport>(allocator, file_handle, false));
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*file_proto->getTransport());
+	auto file_size = transport.GetSize();
+	if (file_size < 12) {
+		throw InvalidInputException("File '%s' too small to be a Parquet file", file_handle.path);
+	}
+
+	ResizeableBuffer buf;
+	buf.resize(allocator, 8);
+	buf.zero();
+
+	transport.SetLocation(file_size - 8);
+	transport.read(buf.ptr, 8);
+
+	bool footer_encrypted;
+	if (memcmp(buf.ptr + 4, "PAR1", 4) == 0) {
+		footer_encrypted = false;
+		if (encryption_config) {
+			throw InvalidInputException("File '%s' is not encrypted, but 'encryption_config' was set",
+			                            file_handle.path);
+		}
+	} else if (memcmp(buf.ptr + 4, "PARE", 4) == 0) {
+		footer_encrypted = true;
+		if (!encryption_config) {
+			throw InvalidInputException("File '%s' is encrypted, but 'encryption_config' was not set",
+			                            file_handle.path);
+		}
+	} else {
+		throw InvalidInputException("No magic bytes found at end of file '%s'", file_handle.path);
+	}
+
+	// read four-byte footer length from just before the end magic bytes
+	auto footer_len = *reinterpret_cast<uint32_t *>(buf.ptr);
+	if (footer_len == 0 || file_size < 12 + footer_len) {
+		throw InvalidInputException("Footer length error in file '%s'", file_handle.path);
+	}
+
+	auto metadata_pos = file_size - (footer_len + 8);
+	transport.SetLocation(metadata_pos);
+	transport.Prefetch(metadata_pos, footer_len);
+
+	auto metadata = make_uniq<FileMetaData>();
+	if (footer_encrypted) {
+		auto crypto_metadata = make_uniq<FileCryptoMetaData>();
+		crypto_metadata->read(file_proto.get());
+		if (crypto_metadata->encryption_algorithm.__isset.AES_GCM_CTR_V1) {
+			throw InvalidInputException("File '%s' is encrypted with AES_GCM_CTR_V1, but only AES_GCM_V1 is supported",
+			                            file_handle.path);
+		}
+		ParquetCrypto::Read(*metadata, *file_proto, encryption_config->GetFooterKey());
+	} else {
+		if (footer_data) {
+			// copy the serialized footer for the footer cache, it is read from the prefetched buffer
+			*footer_data = allocator.Allocate(footer_len);
+			transport.read(footer_data->get(), footer_len);
+			transport.SetLocation(metadata_pos);
+		}
+		metadata->read(file_proto.get());
+	}
+
+	return make_shared<ParquetFileMetadataCache>(std::move(metadata), current_time);
+}
+
+//===--------------------------------------------------------------------===//
+// Footer Cache
+//===--------------------------------------------------------------------===//
+// A cached footer is stored as:
+// magic bytes | file size (8) | last modified (8) | read time (8) | path length (4) | footer length (4) | path | footer
+static constexpr idx_t FOOTER_CACHE_HEADER_SIZE = 4 + 8 + 8 + 8 + 4 + 4;
+
+ParquetFooterCache::ParquetFooterCache(FileSystem &fs, Allocator &allocator, string directory_p)
+    : fs(fs), allocator(allocator), directory(std::move(directory_p)) {
+}
+
+string ParquetFooterCache::GetCachePath(const string &path) const {
+	return fs.JoinPath(directory, to_string(Hash(path.c_str())) + FILE_EXTENSION);
+}
+
+template <class T>
+static T ReadFooterCacheValue(const_data_ptr_t &ptr) {
+	auto result = Load<T>(ptr);
+	ptr += sizeof(T);
+	return result;
+}
+
+template <class T>
+static void WriteFooterCacheValue(BufferedFileWriter &writer, T value) {
+	writer.WriteData(const_data_ptr_cast(&value), sizeof(T));
+}
+
+shared_ptr<ParquetFileMetadataCache> ParquetFooterCache::Read(const string &path, idx_t file_size,
+                                                              time_t last_modified) {
+	try {
+		auto cache_path = GetCachePath(path);
+		auto handle = fs.OpenFile(cache_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		if (!handle) {
+			return nullptr;
+		}
+		auto cache_size = handle->GetFileSize();
+		if (cache_size < FOOTER_CACHE_HEADER_SIZE) {
+			return nullptr;
+		}
+		auto buffer = allocator.Allocate(cache_size);
+		handle->Read(buffer.get(), cache_size, 0);
+
+		const_data_ptr_t ptr = buffer.get();
+		if (memcmp(ptr, MAGIC_BYTES, 4) != 0) {
+			return nullptr;
+		}
+		ptr += 4;
+		auto cached_file_size = ReadFooterCacheValue<uint64_t>(ptr);
+		auto cached_last_modified = ReadFooterCacheValue<int64_t>(ptr);
+		auto read_time = ReadFooterCacheValue<int64_t>(ptr);
+		auto path_len = ReadFooterCacheValue<uint32_t>(ptr);
+		auto footer_len = ReadFooterCacheValue<uint32_t>(ptr);
+		if (cache_size != FOOTER_CACHE_HEADER_SIZE + path_len + footer_len) {
+			return nullptr;
+		}
+		// the footer is only valid if the file has not been modified since it was read (see ParquetReader)
+		if (cached_file_size != file_size || cached_last_modified != int64_t(last_modified) ||
+		    last_modified + 10 >= time_t(read_time)) {
+			return nullptr;
+		}
+		// guard against hash collisions
+		if (string(const_char_ptr_cast(ptr), path_len) != path) {
+			return nullptr;
+		}
+		ptr += path_len;
+
+		auto transport = make_shared<TMemoryBuffer>(const_cast<data_ptr_t>(ptr), footer_len);
+		TCompactProtocolT<TMemoryBuffer> protocol(transport);
+		auto metadata = make_uniq<FileMetaData>();
+		metadata->read(&protocol);
+		return make_shared<ParquetFileMetadataCache>(std::move(metadata), time_t(read_time));
+	} catch (std::exception &ex) {
+		// a corrupt or unreadable cache entry is a cache miss
+		return nullptr;
+	}
+}
+
+void ParquetFooterCache::Write(const string &path, idx_t file_size, time_t last_modified, time_t read_time,
+                               const_data_ptr_t footer, uint32_t footer_len) {
+	if (last_modified + 10 >= read_time) {
+		// the file was modified too recently to be sure the footer matches its modification time
+		return;
+	}
+	string temp_path;
+	try {
+		if (!fs.DirectoryExists(directory)) {
+			fs.CreateDirectory(directory);
+		}
+		// write to a unique temporary file first, so concurrent readers never see a partially written footer
+		auto cache_path = GetCachePath(path);
+		temp_path = cache_path + "." + UUID::ToString(UUID::GenerateRandomUUID()) + ".tmp";
+		{
+			BufferedFileWriter writer(fs, temp_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+			writer.WriteData(const_data_ptr_cast(MAGIC_BYTES), 4);
+			WriteFooterCacheValue<uint64_t>(writer, file_size);
+			WriteFooterCacheValue<int64_t>(writer, last_modified);
+			WriteFooterCacheValue<int64_t>(writer, read_time);
+			WriteFooterCacheValue<uint32_t>(writer, NumericCast<uint32_t>(path.size()));
+			WriteFooterCacheValue<uint32_t>(writer, footer_len);
+			writer.WriteData(const_data_ptr_cast(path.c_str()), path.size());
+			writer.WriteData(footer, footer_len);
+			writer.Sync();
+		}
+		fs.MoveFile(temp_path, cache_path);
+	} catch (std::exception &ex) {
+		// failing to write the footer cache does not fail the query
+		if (!temp_path.empty()) {
+			try {
+				fs.RemoveFile(temp_path);
+			} catch (...) {
+			}
+		}
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Metadata Provider
+//===--------------------------------------------------------------------===//
+ParquetMetadataProvider::ParquetMetadataProvider(ClientContext &context)
+    : fs(FileSystem::GetFileSystem(context)), allocator(BufferAllocator::Get(context)), prefetch_threads(0) {
+	if (ObjectCache::ObjectCacheEnabled(context)) {
+		object_cache = &ObjectCache::GetObjectCache(context);
+	}
+	Value setting;
+	if (context.TryGetCurrentSetting("parquet_metadata_cache_directory", setting) && !setting.IsNull()) {
+		auto directory = setting.ToString();
+		if (!directory.empty()) {
+			footer_cache = make_uniq<ParquetFooterCache>(fs, allocator, std::move(directory));
+		}
+	}
+	if (context.TryGetCurrentSetting("parquet_metadata_prefetch_threads", setting) && !setting.IsNull()) {
+		prefetch_threads = setting.GetValue<uint64_t>();
+	}
+}
+
+shared_ptr<ParquetFileMetadataCache>
+ParquetMetadataProvider::GetMetadata(FileHandle &file_handle,
+                                     const shared_ptr<const ParquetEncryptionConfig> &encryption_config) {
+	// the footer cache holds unencrypted footers only
+	auto use_footer_cache = footer_cache && !encryption_config;
+	if (!object_cache && !use_footer_cache) {
+		return LoadMetadata(allocator, file_handle, encryption_config);
+	}
+	auto &path = file_handle.path;
+	auto last_modify_time = fs.GetLastModifiedTime(file_handle);
+	shared_ptr<ParquetFileMetadataCache> metadata;
+	if (object_cache) {
+		// if the cached version was read too close to the modification of the file it might be outdated
+		metadata = object_cache->Get<ParquetFileMetadataCache>(path);
+		if (metadata && last_modify_time + 10 < metadata->read_time) {
+			return metadata;
+		}
+	}
+	if (use_footer_cache) {
+		auto file_size = file_handle.GetFileSize();
+		metadata = footer_cache->Read(path, file_size, last_modify_time);
+		if (!metadata) {
+			AllocatedData footer_data;
+			metadata = LoadMetadata(allocator, file_handle, encryption_config, &footer_data);
+			if (footer_data.get()) {
+				footer_cache->Write(path, file_size, last_modify_time, metadata->read_time, footer_data.get(),
+				                    NumericCast<uint32_t>(footer_data.GetSize()));
+			}
+		}
+	} else {
+		metadata = LoadMetadata(allocator, file_handle, encryption_config);
+	}
+	if (object_cache) {
+		object_cache->Put(path, metadata);
+	}
+	return metadata;
+}
+
+void ParquetMetadataProvider::Prefetch(const vector<string> &files,
+                                       const shared_ptr<const ParquetEncryptionConfig> &encryption_config) {
+	if (!object_cache || prefetch_threads == 0 || files.size() < 2) {
+		return;
+	}
+	atomic<idx_t> next_file(0);
+	auto prefetch_footers = [&]() {
+		while (true) {
+			auto file_idx = next_file++;
+			if (file_idx >= files.size()) {
+				return;
+			}
+			try {
+				auto handle = fs.OpenFile(files[file_idx], FileFlags::FILE_FLAGS_READ);
+				GetMetadata(*handle, encryption_config);
+			} catch (std::exception &ex) {
+				// the error is thrown when the scan opens the file
+			}
+		}
+	};
+	vector<thread> threads;
+	auto thread_count = MinValue<idx_t>(prefetch_threads, files.size());
+	for (idx_t thread_idx = 0; thread_idx < thread_count; thread_idx++) {
+		threads.emplace_back(prefetch_footers);
+	}
+	for (auto &prefetch_thread : threads) {
+		prefetch_thread.join();
+	}
+}
+
+} // namespace duckdb
@@ -0,0 +1,441 @@
+#include "parquet_manifest.hpp"
+
+#include "parquet_reader.hpp"
+#include "struct_column_reader.hpp"
+
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/multi_file_reader.hpp"
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/buffered_file_reader.hpp"
+#include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/planner/expression/bound_between_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#endif
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Building the manifest
+//===--------------------------------------------------------------------===//
+//! Gets the (exact) min and max of a column chunk, returns false if they are not known
+static bool GetColumnChunkMinMax(ColumnReader &column_reader, idx_t row_group_idx,
+                                 const duckdb_parquet::format::RowGroup &row_group, Value &min, Value &max) {
+	auto &type = column_reader.Type();
+	if (type.id() == LogicalTypeId::VARCHAR) {
+		// the string statistics of the reader only keep a prefix of min and max, so we use the ones from the footer
+		// the deprecated min/max fields are not used, as they might have been written with a signed comparison
+		auto &stats = row_group.columns[column_reader.FileIdx()].meta_data.statistics;
+		if (!stats.__isset.min_value || !stats.__isset.max_value || !Value::StringIsValid(stats.min_value) ||
+		    !Value::StringIsValid(stats.max_value)) {
+			return false;
+		}
+		min = Value(stats.min_value);
+		max = Value(stats.max_value);
+		return true;
+	}
+	if (BaseStatistics::GetStatsType(type) != StatisticsType::NUMERIC_STATS) {
+		return false;
+	}
+	auto stats = column_reader.Stats(row_group_idx, row_group.columns);
+	if (!stats || !NumericStats::HasMinMax(*stats)) {
+		return false;
+	}
+	min = NumericStats::Min(*stats);
+	max = NumericStats::Max(*stats);
+	return true;
+}
+
+ParquetManifestFile ParquetManifestFile::FromReader(ParquetReader &reader) {
+	ParquetManifestFile result;
+	result.file_name = reader.GetFileName();
+	auto file_meta_data = reader.GetFileMetadata();
+	result.row_count = NumericCast<idx_t>(file_meta_data->num_rows);
+
+	auto &root_reader = reader.root_reader->Cast<StructColumnReader>();
+	auto &names = reader.GetNames();
+	auto &types = reader.GetTypes();
+	for (idx_t col_idx = 0; col_idx < names.size(); col_idx++) {
+		if (types[col_idx].IsNested() || col_idx == reader.file_row_number_idx) {
+			continue;
+		}
+		auto &column_reader = *root_reader.GetChildReader(col_idx);
+		ParquetManifestColumn column;
+		column.name = names[col_idx];
+		column.has_null_count = true;
+		bool has_min_max = true;
+		bool has_values = false;
+		for (idx_t row_group_idx = 0; row_group_idx < file_meta_data->row_groups.size(); row_group_idx++) {
+			auto &row_group = file_meta_data->row_groups[row_group_idx];
+			auto &column_chunk = row_group.columns[column_reader.FileIdx()];
+			auto &stats = column_chunk.meta_data.statistics;
+			bool all_null = false;
+			if (column_chunk.__isset.meta_data && stats.__isset.null_count) {
+				column.null_count += NumericCast<idx_t>(stats.null_count);
+				all_null = stats.null_count == row_group.num_rows;
+			} else {
+				column.has_null_count = false;
+			}
+			if (!has_min_max || all_null) {
+				// column chunks without any values do not have a min and max, but they also do not affect them
+				continue;
+			}
+			Value chunk_min, chunk_max;
+			if (!GetColumnChunkMinMax(column_reader, row_group_idx, row_group, chunk_min, chunk_max)) {
+				has_min_max = false;
+				continue;
+			}
+			if (!has_values || chunk_min < column.min) {
+				column.min = std::move(chunk_min);
+			}
+			if (!has_values || chunk_max > column.max) {
+				column.max = std::move(chunk_max);
+			}
+			has_values = true;
+		}
+		column.has_min_max = has_min_max && has_values;
+		if (!column.has_min_max) {
+			column.min = Value();
+			column.max = Value();
+		}
+		if (!column.has_null_count) {
+			column.null_count = 0;
+		}
+		result.columns.push_back(std::move(column));
+	}
+	return result;
+}
+
+optional_ptr<const ParquetManifestColumn> ParquetManifestFile::GetColumn(const string &name) const {
+	for (auto &column : columns) {
+		if (column.name == name) {
+			return &column;
+		}
+	}
+	return nullptr;
+}
+
+void ParquetManifest::AddFile(ParquetManifestFile file) {
+	file_map[file.file_name] = files.size();
+	files.push_back(std::move(file));
+}
+
+optional_ptr<const ParquetManifestFile> ParquetManifest::GetFile(const string &file_name) const {
+	auto entry = file_map.find(file_name);
+	if (entry == file_map.end()) {
+		return nullptr;
+	}
+	return &files[entry->second];
+}
+
+//===--------------------------------------------------------------------===//
+// Reading and writing the manifest
+//===--------------------------------------------------------------------===//
+unique_ptr<ParquetManifest> ParquetManifest::Read(ClientContext &context, const string &path) {
+	auto &fs = FileSystem::GetFileSystem(context);
+	BufferedFileReader reader(fs, path.c_str());
+	char magic[4];
+	if (reader.FileSize() < sizeof(magic)) {
+		throw IOException("File \"%s\" is not a Parquet manifest", path);
+	}
+	reader.ReadData(data_ptr_cast(magic), sizeof(magic));
+	if (memcmp(magic, MAGIC_BYTES, sizeof(magic)) != 0) {
+		throw IOException("File \"%s\" is not a Parquet manifest", path);
+	}
+	auto result = BinaryDeserializer::Deserialize<ParquetManifest>(reader);
+	if (result->version != MANIFEST_VERSION) {
+		throw IOException("Parquet manifest \"%s\" has version %llu, but only version %llu is supported", path,
+		                  result->version, MANIFEST_VERSION);
+	}
+	for (idx_t file_idx = 0; file_idx < result->files.size(); file_idx++) {
+		result->file_map[result->files[file_idx].file_name] = file_idx;
+	}
+	return result;
+}
+
+void ParquetManifest::Write(ClientContext &context, const string &path) const {
+	auto &fs = FileSystem::GetFileSystem(context);
+	BufferedFileWriter writer(fs, path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+	writer.WriteData(const_data_ptr_cast(MAGIC_BYTES), strlen(MAGIC_BYTES));
+	BinarySerializer::Serialize(*this, writer);
+	writer.Sync();
+}
+
+//===--------------------------------------------------------------------===//
+// Pruning files
+//===--------------------------------------------------------------------===//
+//! A filter of the form "column <comparison> constant(s)", or "column IS [NOT] NULL"
+struct ParquetManifestFilter {
+	string column_name;
+	ExpressionType type;
+	vector<Value> constants;
+};
+
+static optional_ptr<const string> GetFilteredColumnName(LogicalGet &get, const Expression &expr) {
+	if (expr.type != ExpressionType::BOUND_COLUMN_REF) {
+		return nullptr;
+	}
+	auto &colref = expr.Cast<BoundColumnRefExpression>();
+	if (colref.depth > 0 || colref.binding.table_index != get.table_index) {
+		return nullptr;
+	}
+	auto column_id = get.column_ids[colref.binding.column_index];
+	if (IsRowIdColumnId(column_id)) {
+		return nullptr;
+	}
+	return &get.names[column_id];
+}
+
+static bool IsUsableConstant(const Expression &expr) {
+	return expr.type == ExpressionType::VALUE_CONSTANT && !expr.Cast<BoundConstantExpression>().value.IsNull();
+}
+
+static void AddComparisonFilter(vector<ParquetManifestFilter> &result, const string &column_name,
+                                ExpressionType comparison_type, const Value &constant) {
+	ParquetManifestFilter filter;
+	filter.column_name = column_name;
+	filter.type = comparison_type;
+	filter.constants.push_back(constant);
+	result.push_back(std::move(filter));
+}
+
+static void ExtractManifestFilters(LogicalGet &get, const Expression &expr, vector<ParquetManifestFilter> &result) {
+	switch (expr.GetExpressionClass()) {
+	case ExpressionClass::BOUND_COMPARISON: {
+		auto &comparison = expr.Cast<BoundComparisonExpression>();
+		switch (comparison.type) {
+		case ExpressionType::COMPARE_EQUAL:
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			break;
+		default:
+			return;
+		}
+		auto column_name = GetFilteredColumnName(get, *comparison.left);
+		if (column_name && IsUsableConstant(*comparison.right)) {
+			AddComparisonFilter(result, *column_name, comparison.type,
+			                    comparison.right->Cast<BoundConstantExpression>().value);
+			return;
+		}
+		column_name = GetFilteredColumnName(get, *comparison.right);
+		if (column_name && IsUsableConstant(*comparison.left)) {
+			AddComparisonFilter(result, *column_name, FlipComparisonExpression(comparison.type),
+			                    comparison.left->Cast<BoundConstantExpression>().value);
+		}
+		return;
+	}
+	case ExpressionClass::BOUND_BETWEEN: {
+		auto &between = expr.Cast<BoundBetweenExpression>();
+		auto column_name = GetFilteredColumnName(get, *between.input);
+		if (!column_name || !IsUsableConstant(*between.lower) || !IsUsableConstant(*between.upper)) {
+			return;
+		}
+		AddComparisonFilter(result, *column_name,
+		                    between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+		                                            : ExpressionType::COMPARE_GREATERTHAN,
+		                    between.lower->Cast<BoundConstantExpression>().value);
+		AddComparisonFilter(result, *column_name,
+		                    between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+		                                            : ExpressionType::COMPARE_LESSTHAN,
+		                    between.upper->Cast<BoundConstantExpression>().value);
+		return;
+	}
+	case ExpressionClass::BOUND_OPERATOR: {
+		auto &op = expr.Cast<BoundOperatorExpression>();
+		if (op.children.empty()) {
+			return;
+		}
+		auto column_name = GetFilteredColumnName(get, *op.children[0]);
+		if (!column_name) {
+			return;
+		}
+		ParquetManifestFilter filter;
+		filter.column_name = *column_name;
+		filter.type = op.type;
+		switch (op.type) {
+		case ExpressionType::OPERATOR_IS_NULL:
+		case ExpressionType::OPERATOR_IS_NOT_NULL:
+			break;
+		case ExpressionType::COMPARE_IN:
+			for (idx_t child_idx = 1; child_idx < op.children.size(); child_idx++) {
+				if (!IsUsableConstant(*op.children[child_idx])) {
+					return;
+				}
+				filter.constants.push_back(op.children[child_idx]->Cast<BoundConstantExpression>().value);
+			}
+			break;
+		default:
+			return;
+		}
+		result.push_back(std::move(filter));
+		return;
+	}
+	default:
+		return;
+	}
+}
+
+//! Whether or not "column <comparison> constant" is false for all values in [min, max]
+static bool ConstantExcludesRange(ExpressionType comparison_type, const Value &constant, const Value &min,
+                                  const Value &max) {
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+	case ExpressionType::COMPARE_IN:
+		return constant < min || constant > max;
+	case ExpressionType::COMPARE_LESSTHAN:
+		return min >= constant;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return min > constant;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return max <= constant;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return max < constant;
+	default:
+		return false;
+	}
+}
+
+static bool FilterExcludesFile(const ParquetManifestFilter &filter, const ParquetManifestFile &file) {
+	auto column = file.GetColumn(filter.column_name);
+	if (!column) {
+		return false;
+	}
+	switch (filter.type) {
+	case ExpressionType::OPERATOR_IS_NULL:
+		return column->has_null_count && column->null_count == 0;
+	case ExpressionType::OPERATOR_IS_NOT_NULL:
+		return column->has_null_count && column->null_count == file.row_count;
+	default:
+		break;
+	}
+	if (!column->has_min_max) {
+		return false;
+	}
+	for (auto &constant : filter.constants) {
+		// we only compare values of the same type - the file might have a different type than the scan
+		if (constant.type() != column->min.type() ||
+		    !ConstantExcludesRange(filter.type, constant, column->min, column->max)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ParquetManifest::PruneFiles(vector<string> &file_list, LogicalGet &get,
+                                 const vector<unique_ptr<Expression>> &filters) const {
+	vector<ParquetManifestFilter> manifest_filters;
+	for (auto &filter : filters) {
+		ExtractManifestFilters(get, *filter, manifest_filters);
+	}
+	if (manifest_filters.empty()) {
+		return false;
+	}
+	vector<string> remaining_files;
+	for (auto &file_name : file_list) {
+		auto file = GetFile(file_name);
+		bool prune_file = false;
+		if (file) {
+			for (auto &filter : manifest_filters) {
+				if (FilterExcludesFile(filter, *file)) {
+					prune_file = true;
+					break;
+				}
+			}
+		}
+		if (!prune_file) {
+			remaining_files.push_back(file_name);
+		}
+	}
+	if (remaining_files.size() == file_list.size()) {
+		return false;
+	}
+	file_list = std::move(remaining_files);
+	return true;
+}
+
+bool ParquetManifest::TryGetRowCount(const vector<string> &file_list, idx_t &result) const {
+	idx_t row_count = 0;
+	for (auto &file_name : file_list) {
+		auto file = GetFile(file_name);
+		if (!file) {
+			return false;
+		}
+		row_count += file->row_count;
+	}
+	result = row_count;
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// parquet_build_manifest
+//===--------------------------------------------------------------------===//
+struct ParquetBuildManifestBindData : public TableFunctionData {
+	vector<string> files;
+	string manifest_path;
+};
+
+struct ParquetBuildManifestState : public GlobalTableFunctionState {
+	bool finished = false;
+};
+
+static unique_ptr<FunctionData> ParquetBuildManifestBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	if (input.inputs[1].IsNull()) {
+		throw BinderException("parquet_build_manifest: the path of the manifest cannot be NULL");
+	}
+	auto result = make_uniq<ParquetBuildManifestBindData>();
+	result->files = MultiFileReader::GetFileList(context, input.inputs[0], "Parquet");
+	result->manifest_path = StringValue::Get(input.inputs[1]);
+
+	names.emplace_back("file_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+	names.emplace_back("row_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+	return std::move(result);
+}
+
+static unique_ptr<GlobalTableFunctionState> ParquetBuildManifestInit(ClientContext &context,
+                                                                     TableFunctionInitInput &input) {
+	return make_uniq<ParquetBuildManifestState>();
+}
+
+static void ParquetBuildManifestImplementation(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<ParquetBuildManifestState>();
+	auto &bind_data = data_p.bind_data->Cast<ParquetBuildManifestBindData>();
+	if (state.finished) {
+		return;
+	}
+	ParquetManifest manifest;
+	idx_t row_count = 0;
+	for (auto &file_name : bind_data.files) {
+		ParquetReader reader(context, file_name, ParquetOptions(context));
+		auto file = ParquetManifestFile::FromReader(reader);
+		row_count += file.row_count;
+		manifest.AddFile(std::move(file));
+	}
+	manifest.Write(context, bind_data.manifest_path);
+
+	output.SetValue(0, 0, Value::BIGINT(NumericCast<int64_t>(manifest.files.size())));
+	output.SetValue(1, 0, Value::BIGINT(NumericCast<int64_t>(row_count)));
+	output.SetCardinality(1);
+	state.finished = true;
+}
+
+TableFunctionSet ParquetBuildManifestFunction::GetFunctionSet() {
+	TableFunctionSet function_set("parquet_build_manifest");
+	TableFunction function("parquet_build_manifest", {LogicalType::VARCHAR, LogicalType::VARCHAR},
+	                       ParquetBuildManifestImplementation, ParquetBuildManifestBind, ParquetBuildManifestInit);
+	function_set.AddFunction(function);
+	function.arguments[0] = LogicalType::LIST(LogicalType::VARCHAR);
+	function_set.AddFunction(std::move(function));
+	return function_set;
+}
+
+} // namespace duckdb
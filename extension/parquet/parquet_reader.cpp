@@ -6,6 +6,7 @@
 #include "column_reader.hpp"
 #include "duckdb.hpp"
 #include "list_column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_file_metadata_cache.hpp"
 #include "parquet_statistics.hpp"
@@ -16,6 +17,7 @@
 #include "templated_column_reader.hpp"
 #include "thrift_tools.hpp"
 #ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/pair.hpp"
@@ -28,6 +30,7 @@
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 #endif
 
 #include <cassert>
@@ -40,7 +43,6 @@ namespace duckdb {
 using duckdb_parquet::format::ColumnChunk;
 using duckdb_parquet::format::ConvertedType;
 using duckdb_parquet::format::FieldRepetitionType;
-using duckdb_parquet::format::FileCryptoMetaData;
 using duckdb_parquet::format::FileMetaData;
 using ParquetRowGroup = duckdb_parquet::format::RowGroup;
 using duckdb_parquet::format::SchemaElement;
@@ -53,68 +55,6 @@ CreateThriftFileProtocol(Allocator &allocator, FileHandle &file_handle, bool pre
 	return make_uniq<duckdb_apache::thrift::protocol::TCompactProtocolT<ThriftFileTransport>>(std::move(transport));
 }
 
-static shared_ptr<ParquetFileMetadataCache>
-LoadMetadata(Allocator &allocator, FileHandle &file_handle,
-             const shared_ptr<const ParquetEncryptionConfig> &encryption_config) {
-	auto current_time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-
-	auto file_proto = CreateThriftFileProtocol(allocator, file_handle, false);
-	auto &transport = reinterpret_cast<ThriftFileTransport &>(*file_proto->getTransport());
-	auto file_size = transport.GetSize();
-	if (file_size < 12) {
-		throw InvalidInputException("File '%s' too small to be a Parquet file", file_handle.path);
-	}
-
-	ResizeableBuffer buf;
-	buf.resize(allocator, 8);
-	buf.zero();
-
-	transport.SetLocation(file_size - 8);
-	transport.read(buf.ptr, 8);
-
-	bool footer_encrypted;
-	if (memcmp(buf.ptr + 4, "PAR1", 4) == 0) {
-		footer_encrypted = false;
-		if (encryption_config) {
-			throw InvalidInputException("File '%s' is not encrypted, but 'encryption_config' was set",
-			                            file_handle.path);
-		}
-	} else if (memcmp(buf.ptr + 4, "PARE", 4) == 0) {
-		footer_encrypted = true;
-		if (!encryption_config) {
-			throw InvalidInputException("File '%s' is encrypted, but 'encryption_config' was not set",
-			                            file_handle.path);
-		}
-	} else {
-		throw InvalidInputException("No magic bytes found at end of file '%s'", file_handle.path);
-	}
-
-	// read four-byte footer length from just before the end magic bytes
-	auto footer_len = *reinterpret_cast<uint32_t *>(buf.ptr);
-	if (footer_len == 0 || file_size < 12 + footer_len) {
-		throw InvalidInputException("Footer length error in file '%s'", file_handle.path);
-	}
-
-	auto metadata_pos = file_size - (footer_len + 8);
-	transport.SetLocation(metadata_pos);
-	transport.Prefetch(metadata_pos, footer_len);
-
-	auto metadata = make_uniq<FileMetaData>();
-	if (footer_encrypted) {
-		auto crypto_metadata = make_uniq<FileCryptoMetaData>();
-		crypto_metadata->read(file_proto.get());
-		if (crypto_metadata->encryption_algorithm.__isset.AES_GCM_CTR_V1) {
-			throw InvalidInputException("File '%s' is encrypted with AES_GCM_CTR_V1, but only AES_GCM_V1 is supported",
-			                            file_handle.path);
-		}
-		ParquetCrypto::Read(*metadata, *file_proto, encryption_config->GetFooterKey());
-	} else {
-		metadata->read(file_proto.get());
-	}
-
-	return make_shared<ParquetFileMetadataCache>(std::move(metadata), current_time);
-}
-
 LogicalType ParquetReader::DeriveLogicalType(const SchemaElement &s_ele, bool binary_as_string) {
 	// inner node
 	if (s_ele.type == Type::FIXED_LEN_BYTE_ARRAY && !s_ele.__isset.type_length) {
@@ -411,6 +351,14 @@ unique_ptr<ColumnReader> ParquetReader::CreateReader() {
 		auto cast_reader = make_uniq<CastColumnReader>(std::move(child_reader), expected_type);
 		root_struct_reader.child_readers[column_idx] = std::move(cast_reader);
 	}
+	// only read the used fields of struct columns
+	for (auto &entry : struct_projections) {
+		auto &child_reader = *root_struct_reader.child_readers[entry.first];
+		if (child_reader.Type().id() == LogicalTypeId::STRUCT &&
+		    reader_data.cast_map.find(entry.first) == reader_data.cast_map.end()) {
+			child_reader.Cast<StructColumnReader>().ApplyProjection(entry.second);
+		}
+	}
 	if (parquet_options.file_row_number) {
 		file_row_number_idx = root_struct_reader.child_readers.size();
 
@@ -481,9 +429,17 @@ ParquetColumnDefinition ParquetColumnDefinition::FromSchemaValue(ClientContext &
 	return result;
 }
 
+static bool PrefetchAllFiles(ClientContext &context) {
+	Value prefetch_all_files;
+	if (context.TryGetCurrentSetting("prefetch_all_parquet_files", prefetch_all_files)) {
+		return prefetch_all_files.GetValue<bool>();
+	}
+	return false;
+}
+
 ParquetReader::ParquetReader(ClientContext &context_p, string file_name_p, ParquetOptions parquet_options_p)
     : fs(FileSystem::GetFileSystem(context_p)), allocator(BufferAllocator::Get(context_p)),
-      parquet_options(std::move(parquet_options_p)) {
+      parquet_options(std::move(parquet_options_p)), prefetch_all_files(PrefetchAllFiles(context_p)) {
 	file_name = std::move(file_name_p);
 	file_handle = fs.OpenFile(file_name, FileFlags::FILE_FLAGS_READ);
 	if (!file_handle->CanSeek()) {
@@ -491,26 +447,16 @@ ParquetReader::ParquetReader(ClientContext &context_p, string file_name_p, Parqu
 		    "Reading parquet files from a FIFO stream is not supported and cannot be efficiently supported since "
 		    "metadata is located at the end of the file. Write the stream to disk first and read from there instead.");
 	}
-	// If object cached is disabled
-	// or if this file has cached metadata
-	// or if the cached version already expired
-	if (!ObjectCache::ObjectCacheEnabled(context_p)) {
-		metadata = LoadMetadata(allocator, *file_handle, parquet_options.encryption_config);
-	} else {
-		auto last_modify_time = fs.GetLastModifiedTime(*file_handle);
-		metadata = ObjectCache::GetObjectCache(context_p).Get<ParquetFileMetadataCache>(file_name);
-		if (!metadata || (last_modify_time + 10 >= metadata->read_time)) {
-			metadata = LoadMetadata(allocator, *file_handle, parquet_options.encryption_config);
-			ObjectCache::GetObjectCache(context_p).Put(file_name, metadata);
-		}
-	}
+	ParquetMetadataProvider metadata_provider(context_p);
+	metadata = metadata_provider.GetMetadata(*file_handle, parquet_options.encryption_config);
 	InitializeSchema();
 }
 
 ParquetReader::ParquetReader(ClientContext &context_p, ParquetOptions parquet_options_p,
                              shared_ptr<ParquetFileMetadataCache> metadata_p)
     : fs(FileSystem::GetFileSystem(context_p)), allocator(BufferAllocator::Get(context_p)),
-      metadata(std::move(metadata_p)), parquet_options(std::move(parquet_options_p)) {
+      metadata(std::move(metadata_p)), parquet_options(std::move(parquet_options_p)),
+      prefetch_all_files(PrefetchAllFiles(context_p)) {
 	InitializeSchema();
 }
 
@@ -669,221 +615,259 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
-idx_t ParquetReader::NumRows() {
-	return GetFileMetadata()->num_rows;
+static void ReadPageIndex(TProtocol &protocol, int64_t offset, int32_t length, duckdb_apache::thrift::TBase &result) {
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*protocol.getTransport());
+	transport.ClearPrefetch();
+	transport.Prefetch(NumericCast<idx_t>(offset), NumericCast<idx_t>(length));
+	transport.SetLocation(NumericCast<idx_t>(offset));
+	result.read(&protocol);
 }
 
-idx_t ParquetReader::NumRowGroups() {
-	return GetFileMetadata()->row_groups.size();
+shared_ptr<ParquetBloomFilter> ParquetReader::GetBloomFilter(ParquetReaderScanState &state,
+                                                             const ColumnChunk &column_chunk) {
+	auto &meta_data = column_chunk.meta_data;
+	if (!meta_data.__isset.bloom_filter_offset || !meta_data.__isset.bloom_filter_length) {
+		return nullptr;
+	}
+	auto offset = NumericCast<idx_t>(meta_data.bloom_filter_offset);
+	shared_ptr<ParquetBloomFilter> result;
+	if (metadata->TryGetBloomFilter(offset, result)) {
+		return result;
+	}
+	auto bloom_filter_proto = CreateThriftFileProtocol(allocator, *state.file_handle, false);
+	auto &transport = reinterpret_cast<ThriftFileTransport &>(*bloom_filter_proto->getTransport());
+	transport.Prefetch(offset, NumericCast<idx_t>(meta_data.bloom_filter_length));
+	transport.SetLocation(offset);
+	result = ParquetBloomFilter::Read(*bloom_filter_proto);
+	metadata->AddBloomFilter(offset, result);
+	return result;
 }
 
-void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t> groups_to_read) {
-	state.current_group = -1;
-	state.finished = false;
-	state.group_offset = 0;
-	state.group_idx_list = std::move(groups_to_read);
-	state.sel.Initialize(STANDARD_VECTOR_SIZE);
-	if (!state.file_handle || state.file_handle->path != file_handle->path) {
-		auto flags = FileFlags::FILE_FLAGS_READ;
-
-		if (!file_handle->OnDiskFile() && file_handle->CanSeek()) {
-			state.prefetch_mode = true;
-			flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
-		} else {
-			state.prefetch_mode = false;
+static bool BloomFilterExcludesFilter(const ParquetBloomFilter &bloom_filter, const LogicalType &type,
+                                      duckdb_parquet::format::Type::type parquet_type, const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		uint64_t hash;
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    constant_filter.constant.type() != type ||
+		    !ParquetBloomFilter::TryHashConstant(constant_filter.constant, parquet_type, hash)) {
+			return false;
 		}
-
-		state.file_handle = fs.OpenFile(file_handle->path, flags);
+		return !bloom_filter.FilterCheck(hash);
 	}
-
-	state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode);
-	state.root_reader = CreateReader();
-	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
-	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
-}
-
-void FilterIsNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
-	if (v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		auto &mask = ConstantVector::Validity(v);
-		if (mask.RowIsValid(0)) {
-			filter_mask.reset();
+	case TableFilterType::CONJUNCTION_OR: {
+		// all of the alternatives must be excluded (e.g. for an IN list)
+		auto &or_filter = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : or_filter.child_filters) {
+			if (!BloomFilterExcludesFilter(bloom_filter, type, parquet_type, *child_filter)) {
+				return false;
+			}
 		}
-		return;
+		return !or_filter.child_filters.empty();
 	}
-	D_ASSERT(v.GetVectorType() == VectorType::FLAT_VECTOR);
-
-	auto &mask = FlatVector::Validity(v);
-	if (mask.AllValid()) {
-		filter_mask.reset();
-	} else {
-		for (idx_t i = 0; i < count; i++) {
-			filter_mask[i] = filter_mask[i] && !mask.RowIsValid(i);
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &and_filter = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : and_filter.child_filters) {
+			if (BloomFilterExcludesFilter(bloom_filter, type, parquet_type, *child_filter)) {
+				return true;
+			}
 		}
+		return false;
+	}
+	default:
+		return false;
 	}
 }
 
-void FilterIsNotNull(Vector &v, parquet_filter_t &filter_mask, idx_t count) {
-	if (v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		auto &mask = ConstantVector::Validity(v);
-		if (!mask.RowIsValid(0)) {
-			filter_mask.reset();
-		}
-		return;
+bool ParquetReader::BloomFilterExcludes(ParquetReaderScanState &state, ColumnReader &column_reader,
+                                        const TableFilter &filter) {
+	if (!ParquetBloomFilter::TypeIsSupported(column_reader.Type())) {
+		return false;
 	}
-	D_ASSERT(v.GetVectorType() == VectorType::FLAT_VECTOR);
-
-	auto &mask = FlatVector::Validity(v);
-	if (!mask.AllValid()) {
-		for (idx_t i = 0; i < count; i++) {
-			filter_mask[i] = filter_mask[i] && mask.RowIsValid(i);
-		}
+	auto &group = GetGroup(state);
+	auto bloom_filter = GetBloomFilter(state, group.columns[column_reader.FileIdx()]);
+	if (!bloom_filter) {
+		return false;
 	}
+	return BloomFilterExcludesFilter(*bloom_filter, column_reader.Type(), column_reader.Schema().type, filter);
 }
 
-template <class T, class OP>
-void TemplatedFilterOperation(Vector &v, T constant, parquet_filter_t &filter_mask, idx_t count) {
-	if (v.GetVectorType() == VectorType::CONSTANT_VECTOR) {
-		auto v_ptr = ConstantVector::GetData<T>(v);
-		auto &mask = ConstantVector::Validity(v);
+void ParquetReader::PrunePages(ParquetReaderScanState &state) {
+	state.pruned_ranges.clear();
+	auto &group = GetGroup(state);
+	auto group_rows = NumericCast<idx_t>(group.num_rows);
+	if (state.group_offset >= group_rows) {
+		return;
+	}
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	auto index_proto = CreateThriftFileProtocol(allocator, *state.file_handle, false);
 
-		if (mask.RowIsValid(0)) {
-			if (!OP::Operation(v_ptr[0], constant)) {
-				filter_mask.reset();
+	// the rows outside of the scanned part of the group are pruned as well
+	vector<pair<idx_t, idx_t>> ranges;
+	if (state.group_row_start > 0) {
+		ranges.emplace_back(0, MinValue<idx_t>(state.group_row_start, group_rows));
+	}
+	if (state.group_row_end < group_rows) {
+		ranges.emplace_back(state.group_row_end, group_rows);
+	}
+	if (reader_data.filters && !parquet_options.encryption_config) {
+		for (auto &filter_col : reader_data.filters->filters) {
+			auto &filter_entry = reader_data.filter_map[filter_col.first];
+			if (filter_entry.is_constant) {
+				continue;
+			}
+			auto column_reader = root_reader.GetChildReader(reader_data.column_ids[filter_entry.index]);
+			if (!column_reader->CanUsePageIndex()) {
+				continue;
+			}
+			if (BloomFilterExcludes(state, *column_reader, *filter_col.second)) {
+				// the bloom filter proves that no row of this group can match: skip the whole group
+				state.group_offset = group.num_rows;
+				return;
+			}
+			auto &column_chunk = group.columns[column_reader->FileIdx()];
+			if (!column_chunk.__isset.column_index_offset || !column_chunk.__isset.offset_index_offset) {
+				continue;
+			}
+			duckdb_parquet::format::ColumnIndex column_index;
+			duckdb_parquet::format::OffsetIndex offset_index;
+			ReadPageIndex(*index_proto, column_chunk.column_index_offset, column_chunk.column_index_length,
+			              column_index);
+			ReadPageIndex(*index_proto, column_chunk.offset_index_offset, column_chunk.offset_index_length,
+			              offset_index);
+
+			auto &page_locations = offset_index.page_locations;
+			for (idx_t page_idx = 0; page_idx < page_locations.size(); page_idx++) {
+				auto stats = ParquetStatisticsUtils::TransformPageStatistics(*column_reader, column_index, page_idx);
+				if (!stats ||
+				    filter_col.second->CheckStatistics(*stats) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+					continue;
+				}
+				auto page_start = NumericCast<idx_t>(page_locations[page_idx].first_row_index);
+				auto page_end = page_idx + 1 < page_locations.size()
+				                    ? NumericCast<idx_t>(page_locations[page_idx + 1].first_row_index)
+				                    : NumericCast<idx_t>(group.num_rows);
+				ranges.emplace_back(page_start, page_end);
 			}
 		}
+	}
+	if (ranges.empty()) {
 		return;
 	}
+	// merge the pruned pages of the different columns into non-overlapping row ranges
+	std::sort(ranges.begin(), ranges.end());
+	for (auto &range : ranges) {
+		if (!state.pruned_ranges.empty() && range.first <= state.pruned_ranges.back().second) {
+			state.pruned_ranges.back().second = MaxValue<idx_t>(state.pruned_ranges.back().second, range.second);
+		} else {
+			state.pruned_ranges.push_back(range);
+		}
+	}
 
-	D_ASSERT(v.GetVectorType() == VectorType::FLAT_VECTOR);
-	auto v_ptr = FlatVector::GetData<T>(v);
-	auto &mask = FlatVector::Validity(v);
-
-	if (!mask.AllValid()) {
-		for (idx_t i = 0; i < count; i++) {
-			if (mask.RowIsValid(i)) {
-				filter_mask[i] = filter_mask[i] && OP::Operation(v_ptr[i], constant);
-			}
+	if (parquet_options.encryption_config) {
+		// the pruned rows are skipped by decoding them
+		return;
+	}
+	// hand the page locations to the readers of all columns, so they can jump over the pruned pages
+	for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+		auto column_reader = root_reader.GetChildReader(reader_data.column_ids[col_idx]);
+		if (!column_reader->CanUsePageIndex()) {
+			continue;
 		}
-	} else {
-		for (idx_t i = 0; i < count; i++) {
-			filter_mask[i] = filter_mask[i] && OP::Operation(v_ptr[i], constant);
+		auto &column_chunk = group.columns[column_reader->FileIdx()];
+		if (!column_chunk.__isset.offset_index_offset) {
+			continue;
 		}
+		duckdb_parquet::format::OffsetIndex offset_index;
+		ReadPageIndex(*index_proto, column_chunk.offset_index_offset, column_chunk.offset_index_length, offset_index);
+		column_reader->SetPageIndex(std::move(offset_index.page_locations), state.pruned_ranges);
 	}
 }
 
-template <class T, class OP>
-void TemplatedFilterOperation(Vector &v, const Value &constant, parquet_filter_t &filter_mask, idx_t count) {
-	TemplatedFilterOperation<T, OP>(v, constant.template GetValueUnsafe<T>(), filter_mask, count);
+idx_t ParquetReader::NumRows() {
+	return GetFileMetadata()->num_rows;
 }
 
-template <class OP>
-static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &filter_mask, idx_t count) {
-	if (filter_mask.none() || count == 0) {
-		return;
-	}
-	switch (v.GetType().InternalType()) {
-	case PhysicalType::BOOL:
-		TemplatedFilterOperation<bool, OP>(v, constant, filter_mask, count);
-		break;
-	case PhysicalType::UINT8:
-		TemplatedFilterOperation<uint8_t, OP>(v, constant, filter_mask, count);
-		break;
-	case PhysicalType::UINT16:
-		TemplatedFilterOperation<uint16_t, OP>(v, constant, filter_mask, count);
-		break;
-	case PhysicalType::UINT32:
-		TemplatedFilterOperation<uint32_t, OP>(v, constant, filter_mask, count);
-		break;
-	case PhysicalType::UINT64:
-		TemplatedFilterOperation<uint64_t, OP>(v, constant, filter_mask, count);
-		break;
-	case PhysicalType::INT8:
-		TemplatedFilterOperation<int8_t, OP>(v, constant, filter_mask, count);
-		break;
-	case PhysicalType::INT16:
-		TemplatedFilterOperation<int16_t, OP>(v, constant, filter_mask, count);
-		break;
-	case PhysicalType::INT32:
-		TemplatedFilterOperation<int32_t, OP>(v, constant, filter_mask, count);
-		break;
-	case PhysicalType::INT64:
-		TemplatedFilterOperation<int64_t, OP>(v, constant, filter_mask, count);
-		break;
-	case PhysicalType::INT128:
-		TemplatedFilterOperation<hugeint_t, OP>(v, constant, filter_mask, count);
-		break;
-	case PhysicalType::FLOAT:
-		TemplatedFilterOperation<float, OP>(v, constant, filter_mask, count);
-		break;
-	case PhysicalType::DOUBLE:
-		TemplatedFilterOperation<double, OP>(v, constant, filter_mask, count);
-		break;
-	case PhysicalType::VARCHAR:
-		TemplatedFilterOperation<string_t, OP>(v, constant, filter_mask, count);
-		break;
-	default:
-		throw NotImplementedException("Unsupported type for filter %s", v.ToString());
-	}
+idx_t ParquetReader::NumRowGroups() {
+	return GetFileMetadata()->row_groups.size();
 }
 
-static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
-	switch (filter.filter_type) {
-	case TableFilterType::CONJUNCTION_AND: {
-		auto &conjunction = filter.Cast<ConjunctionAndFilter>();
-		for (auto &child_filter : conjunction.child_filters) {
-			ApplyFilter(v, *child_filter, filter_mask, count);
-		}
-		break;
+idx_t ParquetReader::NumGroupRows(idx_t group_idx) {
+	return NumericCast<idx_t>(GetFileMetadata()->row_groups[group_idx].num_rows);
+}
+
+bool ParquetReader::CanScanGroupInParts(idx_t group_idx) {
+	if (parquet_options.encryption_config) {
+		return false;
 	}
-	case TableFilterType::CONJUNCTION_OR: {
-		auto &conjunction = filter.Cast<ConjunctionOrFilter>();
-		parquet_filter_t or_mask;
-		for (auto &child_filter : conjunction.child_filters) {
-			parquet_filter_t child_mask = filter_mask;
-			ApplyFilter(v, *child_filter, child_mask, count);
-			or_mask |= child_mask;
+	auto &group = GetFileMetadata()->row_groups[group_idx];
+	auto &root_struct_reader = root_reader->Cast<StructColumnReader>();
+	for (auto &column_id : reader_data.column_ids) {
+		auto column_reader = root_struct_reader.GetChildReader(column_id);
+		if (!column_reader->CanSkipWithPageIndex()) {
+			return false;
+		}
+		if (column_id == file_row_number_idx) {
+			continue;
+		}
+		auto file_idx = column_reader->FileIdx();
+		if (file_idx >= group.columns.size() || !group.columns[file_idx].__isset.offset_index_offset) {
+			return false;
 		}
-		filter_mask &= or_mask;
-		break;
 	}
-	case TableFilterType::CONSTANT_COMPARISON: {
-		auto &constant_filter = filter.Cast<ConstantFilter>();
-		switch (constant_filter.comparison_type) {
-		case ExpressionType::COMPARE_EQUAL:
-			FilterOperationSwitch<Equals>(v, constant_filter.constant, filter_mask, count);
-			break;
-		case ExpressionType::COMPARE_LESSTHAN:
-			FilterOperationSwitch<LessThan>(v, constant_filter.constant, filter_mask, count);
-			break;
-		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
-			FilterOperationSwitch<LessThanEquals>(v, constant_filter.constant, filter_mask, count);
-			break;
-		case ExpressionType::COMPARE_GREATERTHAN:
-			FilterOperationSwitch<GreaterThan>(v, constant_filter.constant, filter_mask, count);
-			break;
-		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
-			FilterOperationSwitch<GreaterThanEquals>(v, constant_filter.constant, filter_mask, count);
-			break;
-		default:
-			D_ASSERT(0);
+	return true;
+}
+
+void ParquetReader::InitializeScan(ParquetReaderScanState &state, vector<idx_t> groups_to_read) {
+	state.current_group = -1;
+	state.finished = false;
+	state.group_offset = 0;
+	state.group_idx_list = std::move(groups_to_read);
+	state.group_row_start = 0;
+	state.group_row_end = NumericLimits<idx_t>::Maximum();
+	if (!state.file_handle || state.file_handle->path != file_handle->path) {
+		auto flags = FileFlags::FILE_FLAGS_READ;
+
+		if (!file_handle->OnDiskFile() && file_handle->CanSeek()) {
+			state.prefetch_mode = true;
+			flags |= FileFlags::FILE_FLAGS_DIRECT_IO;
+		} else {
+			state.prefetch_mode = prefetch_all_files;
+		}
+
+		// the transport might still be fetching ranges using the current handles
+		state.thrift_file_proto.reset();
+		state.file_handle = fs.OpenFile(file_handle->path, flags);
+		state.fetch_handles.reset();
+		if (state.prefetch_mode) {
+			state.fetch_handles = make_uniq<ConcurrentFetchHandles>(
+			    fs, file_handle->path, flags, ParquetReaderPrefetchConfig::MAXIMUM_CONCURRENT_FETCHES);
 		}
-		break;
 	}
-	case TableFilterType::IS_NOT_NULL:
-		FilterIsNotNull(v, filter_mask, count);
-		break;
-	case TableFilterType::IS_NULL:
-		FilterIsNull(v, filter_mask, count);
-		break;
-	case TableFilterType::STRUCT_EXTRACT: {
-		auto &struct_filter = filter.Cast<StructFilter>();
-		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
-		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
-	} break;
-	default:
-		D_ASSERT(0);
-		break;
+
+	state.thrift_file_proto = CreateThriftFileProtocol(allocator, *state.file_handle, state.prefetch_mode);
+	if (state.fetch_handles) {
+		auto &transport = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+		transport.SetConcurrentFetchHandles(*state.fetch_handles);
 	}
+	state.root_reader = CreateReader();
+	state.define_buf.resize(allocator, STANDARD_VECTOR_SIZE);
+	state.repeat_buf.resize(allocator, STANDARD_VECTOR_SIZE);
+}
+
+void ParquetReader::InitializeScan(ParquetReaderScanState &state, idx_t group_idx, idx_t row_start, idx_t row_end) {
+	D_ASSERT(row_start < row_end && row_end <= NumGroupRows(group_idx));
+	InitializeScan(state, vector<idx_t> {group_idx});
+	state.group_row_start = row_start;
+	state.group_row_end = row_end;
+}
+
+static void ApplyFilter(Vector &v, const TableFilter &filter, SelectionVector &sel, idx_t &approved_tuple_count,
+                        idx_t count) {
+	UnifiedVectorFormat vdata;
+	v.ToUnifiedFormat(count, vdata);
+	ColumnSegment::FilterSelection(sel, v, vdata, filter, count, approved_tuple_count);
 }
 
 void ParquetReader::Scan(ParquetReaderScanState &state, DataChunk &result) {
@@ -923,6 +907,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			auto &root_reader = state.root_reader->Cast<StructColumnReader>();
 			to_scan_compressed_bytes += root_reader.GetChildReader(file_col_idx)->TotalCompressedSize();
 		}
+		PrunePages(state);
 
 		auto &group = GetGroup(state);
 		if (state.prefetch_mode && state.group_offset != (idx_t)group.num_rows) {
@@ -936,7 +921,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				    "Malformed parquet file: sum of total compressed bytes of columns seems incorrect");
 			}
 
-			if (!reader_data.filters &&
+			if (!reader_data.filters && state.pruned_ranges.empty() &&
 			    scan_percentage > ParquetReaderPrefetchConfig::WHOLE_GROUP_PREFETCH_MINIMUM_SCAN) {
 				// Prefetch the whole row group
 				if (!state.current_group_prefetched) {
@@ -974,7 +959,28 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 		return true;
 	}
 
-	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+
+	idx_t max_chunk_rows = STANDARD_VECTOR_SIZE;
+	for (auto &range : state.pruned_ranges) {
+		if (range.second <= state.group_offset) {
+			continue;
+		}
+		if (range.first <= state.group_offset) {
+			// the rows at the current offset were pruned using the page index: skip them in all columns
+			auto skip_count = range.second - state.group_offset;
+			for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+				root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_count);
+			}
+			state.group_offset += skip_count;
+			return true;
+		}
+		// stop at the start of the next pruned range, so we never read any of its pages
+		max_chunk_rows = MinValue<idx_t>(max_chunk_rows, range.first - state.group_offset);
+		break;
+	}
+
+	auto this_output_chunk_rows = MinValue<idx_t>(max_chunk_rows, GetGroup(state).num_rows - state.group_offset);
 	result.SetCardinality(this_output_chunk_rows);
 
 	if (this_output_chunk_rows == 0) {
@@ -998,23 +1004,33 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	auto define_ptr = (uint8_t *)state.define_buf.ptr;
 	auto repeat_ptr = (uint8_t *)state.repeat_buf.ptr;
 
-	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
-
 	if (reader_data.filters) {
 		vector<bool> need_to_read(reader_data.column_ids.size(), true);
-
-		// first load the columns that are used in filters
-		for (auto &filter_col : reader_data.filters->filters) {
-			if (filter_mask.none()) {
+		auto &filters = reader_data.filters->filters;
+		if (!state.adaptive_filter || state.adaptive_filter->permutation.size() != filters.size()) {
+			state.adaptive_filter = make_uniq<AdaptiveFilter>(reader_data.filters.get());
+		}
+		auto start_time = high_resolution_clock::now();
+
+		// first load the columns that are used in filters, in the order that has been the cheapest so far
+		// every filter only looks at the rows that passed the previous ones, and every column only decodes those rows
+		SelectionVector sel;
+		sel.Initialize(nullptr);
+		idx_t approved_tuple_count = this_output_chunk_rows;
+		for (idx_t i = 0; i < filters.size(); i++) {
+			if (approved_tuple_count == 0) {
 				// if no rows are left we can stop checking filters
 				break;
 			}
-			auto filter_entry = reader_data.filter_map[filter_col.first];
+			auto filter_idx = state.adaptive_filter->permutation[i];
+			auto &filter = *filters[filter_idx];
+			auto filter_entry = reader_data.filter_map[filter_idx];
+			auto previous_count = approved_tuple_count;
 			if (filter_entry.is_constant) {
 				// this is a constant vector, look for the constant
 				auto &constant = reader_data.constant_map[filter_entry.index].value;
 				Vector constant_vector(constant);
-				ApplyFilter(constant_vector, *filter_col.second, filter_mask, this_output_chunk_rows);
+				ApplyFilter(constant_vector, filter, sel, approved_tuple_count, this_output_chunk_rows);
 			} else {
 				auto id = filter_entry.index;
 				auto file_col_idx = reader_data.column_ids[id];
@@ -1025,7 +1041,13 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				child_reader->Read(result.size(), filter_mask, define_ptr, repeat_ptr, result_vector);
 				need_to_read[id] = false;
 
-				ApplyFilter(result_vector, *filter_col.second, filter_mask, this_output_chunk_rows);
+				ApplyFilter(result_vector, filter, sel, approved_tuple_count, this_output_chunk_rows);
+			}
+			if (approved_tuple_count != previous_count) {
+				filter_mask.reset();
+				for (idx_t sel_idx = 0; sel_idx < approved_tuple_count; sel_idx++) {
+					filter_mask.set(sel.get_index(sel_idx));
+				}
 			}
 		}
 
@@ -1035,7 +1057,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 				continue;
 			}
 			auto file_col_idx = reader_data.column_ids[col_idx];
-			if (filter_mask.none()) {
+			if (approved_tuple_count == 0) {
 				root_reader.GetChildReader(file_col_idx)->Skip(result.size());
 				continue;
 			}
@@ -1044,14 +1066,14 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 			child_reader->Read(result.size(), filter_mask, define_ptr, repeat_ptr, result_vector);
 		}
 
-		idx_t sel_size = 0;
-		for (idx_t i = 0; i < this_output_chunk_rows; i++) {
-			if (filter_mask[i]) {
-				state.sel.set_index(sel_size++, i);
-			}
+		auto end_time = high_resolution_clock::now();
+		if (filters.size() > 1) {
+			state.adaptive_filter->AdaptRuntimeStatistics(
+			    duration_cast<duration<double>>(end_time - start_time).count());
+		}
+		if (approved_tuple_count != this_output_chunk_rows) {
+			result.Slice(sel, approved_tuple_count);
 		}
-
-		result.Slice(state.sel, sel_size);
 	} else {
 		for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
 			auto file_col_idx = reader_data.column_ids[col_idx];
@@ -350,9 +350,11 @@ void VerifyUniqueNames(const vector<string> &names) {
 ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalType> types_p, vector<string> names_p,
                              CompressionCodec::type codec, ChildFieldIDs field_ids_p,
                              const vector<pair<string, string>> &kv_metadata,
-                             shared_ptr<ParquetEncryptionConfig> encryption_config_p)
+                             shared_ptr<ParquetEncryptionConfig> encryption_config_p,
+                             const vector<idx_t> &bloom_filter_columns, ParquetVersion parquet_version)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
-      field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)) {
+      field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
+      parquet_version(parquet_version) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -369,7 +371,7 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalT
 	protocol = tproto_factory.getProtocol(make_shared<MyTransport>(*writer));
 
 	file_meta_data.num_rows = 0;
-	file_meta_data.version = 1;
+	file_meta_data.version = static_cast<int32_t>(parquet_version);
 
 	file_meta_data.__isset.created_by = true;
 	file_meta_data.created_by = "DuckDB";
@@ -399,6 +401,9 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalT
 		column_writers.push_back(ColumnWriter::CreateWriterRecursive(file_meta_data.schema, *this, sql_types[i],
 		                                                             unique_names[i], schema_path, &field_ids));
 	}
+	for (auto &col_idx : bloom_filter_columns) {
+		column_writers[col_idx]->write_bloom_filter = true;
+	}
 }
 
 void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
@@ -459,6 +464,12 @@ void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGro
 			}
 		}
 
+		// finish encoding and compressing the column chunks here, so that only the actual writing happens in
+		// FlushRowGroup (which is serialized)
+		for (idx_t i = 0; i < next; i++) {
+			col_writers[i].get().FinishWrite(*write_states[i]);
+		}
+
 		for (auto &write_state : write_states) {
 			states.push_back(std::move(write_state));
 		}
@@ -499,7 +510,65 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	FlushRowGroup(prepared_row_group);
 }
 
+void ParquetWriter::AddPageIndex(unique_ptr<ParquetPageIndex> page_index) {
+	if (encryption_config) {
+		// we do not write (encrypted) page indexes for encrypted files
+		return;
+	}
+	// this is called while flushing a row group, before it is appended to the file meta data
+	page_index->row_group_idx = file_meta_data.row_groups.size();
+	page_indexes.push_back(std::move(page_index));
+}
+
+void ParquetWriter::AddBloomFilter(idx_t column_idx, unique_ptr<ParquetBloomFilter> bloom_filter) {
+	if (encryption_config) {
+		// we do not write (encrypted) bloom filters for encrypted files
+		return;
+	}
+	ParquetColumnBloomFilter entry;
+	entry.row_group_idx = file_meta_data.row_groups.size();
+	entry.column_idx = column_idx;
+	entry.bloom_filter = std::move(bloom_filter);
+	bloom_filters.push_back(std::move(entry));
+}
+
+void ParquetWriter::WriteBloomFilters() {
+	for (auto &entry : bloom_filters) {
+		auto &column_chunk = file_meta_data.row_groups[entry.row_group_idx].columns[entry.column_idx];
+		auto offset = writer->GetTotalWritten();
+		entry.bloom_filter->Write(*protocol);
+		column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(offset));
+		column_chunk.meta_data.__set_bloom_filter_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	bloom_filters.clear();
+}
+
+void ParquetWriter::WritePageIndexes() {
+	// all column indexes are written first, followed by all offset indexes
+	for (auto &page_index : page_indexes) {
+		if (!page_index->has_column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[page_index->row_group_idx].columns[page_index->column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(page_index->column_index);
+		column_chunk.__set_column_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_column_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	for (auto &page_index : page_indexes) {
+		auto &column_chunk = file_meta_data.row_groups[page_index->row_group_idx].columns[page_index->column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(page_index->offset_index);
+		column_chunk.__set_offset_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_offset_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	page_indexes.clear();
+}
+
 void ParquetWriter::Finalize() {
+	WriteBloomFilters();
+	WritePageIndexes();
+
 	auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
@@ -10,6 +10,9 @@
 #include "parquet_reader.hpp"
 #include "parquet_writer.hpp"
 #include "parquet_writer.hpp"
+#include "parquet_manifest.hpp"
+#include "parquet_manifest.hpp"
+#include "parquet_manifest.hpp"
 
 namespace duckdb {
 
@@ -65,12 +68,59 @@ shared_ptr<ParquetEncryptionConfig> ParquetEncryptionConfig::Deserialize(Deseria
 	return result;
 }
 
+void ParquetManifest::Serialize(Serializer &serializer) const {
+	serializer.WritePropertyWithDefault<idx_t>(100, "version", version);
+	serializer.WritePropertyWithDefault<vector<ParquetManifestFile>>(101, "files", files);
+}
+
+unique_ptr<ParquetManifest> ParquetManifest::Deserialize(Deserializer &deserializer) {
+	auto result = duckdb::unique_ptr<ParquetManifest>(new ParquetManifest());
+	deserializer.ReadPropertyWithDefault<idx_t>(100, "version", result->version);
+	deserializer.ReadPropertyWithDefault<vector<ParquetManifestFile>>(101, "files", result->files);
+	return result;
+}
+
+void ParquetManifestColumn::Serialize(Serializer &serializer) const {
+	serializer.WritePropertyWithDefault<string>(100, "name", name);
+	serializer.WritePropertyWithDefault<bool>(101, "has_min_max", has_min_max);
+	serializer.WriteProperty<Value>(102, "min", min);
+	serializer.WriteProperty<Value>(103, "max", max);
+	serializer.WritePropertyWithDefault<bool>(104, "has_null_count", has_null_count);
+	serializer.WritePropertyWithDefault<idx_t>(105, "null_count", null_count);
+}
+
+ParquetManifestColumn ParquetManifestColumn::Deserialize(Deserializer &deserializer) {
+	ParquetManifestColumn result;
+	deserializer.ReadPropertyWithDefault<string>(100, "name", result.name);
+	deserializer.ReadPropertyWithDefault<bool>(101, "has_min_max", result.has_min_max);
+	deserializer.ReadProperty<Value>(102, "min", result.min);
+	deserializer.ReadProperty<Value>(103, "max", result.max);
+	deserializer.ReadPropertyWithDefault<bool>(104, "has_null_count", result.has_null_count);
+	deserializer.ReadPropertyWithDefault<idx_t>(105, "null_count", result.null_count);
+	return result;
+}
+
+void ParquetManifestFile::Serialize(Serializer &serializer) const {
+	serializer.WritePropertyWithDefault<string>(100, "file_name", file_name);
+	serializer.WritePropertyWithDefault<idx_t>(101, "row_count", row_count);
+	serializer.WritePropertyWithDefault<vector<ParquetManifestColumn>>(102, "columns", columns);
+}
+
+ParquetManifestFile ParquetManifestFile::Deserialize(Deserializer &deserializer) {
+	ParquetManifestFile result;
+	deserializer.ReadPropertyWithDefault<string>(100, "file_name", result.file_name);
+	deserializer.ReadPropertyWithDefault<idx_t>(101, "row_count", result.row_count);
+	deserializer.ReadPropertyWithDefault<vector<ParquetManifestColumn>>(102, "columns", result.columns);
+	return result;
+}
+
 void ParquetOptions::Serialize(Serializer &serializer) const {
 	serializer.WritePropertyWithDefault<bool>(100, "binary_as_string", binary_as_string);
 	serializer.WritePropertyWithDefault<bool>(101, "file_row_number", file_row_number);
 	serializer.WriteProperty<MultiFileReaderOptions>(102, "file_options", file_options);
 	serializer.WritePropertyWithDefault<vector<ParquetColumnDefinition>>(103, "schema", schema);
 	serializer.WritePropertyWithDefault<shared_ptr<ParquetEncryptionConfig>>(104, "encryption_config", encryption_config, nullptr);
+	serializer.WritePropertyWithDefault<string>(105, "manifest_path", manifest_path, "");
 }
 
 ParquetOptions ParquetOptions::Deserialize(Deserializer &deserializer) {
@@ -80,6 +130,7 @@ ParquetOptions ParquetOptions::Deserialize(Deserializer &deserializer) {
 	deserializer.ReadProperty<MultiFileReaderOptions>(102, "file_options", result.file_options);
 	deserializer.ReadPropertyWithDefault<vector<ParquetColumnDefinition>>(103, "schema", result.schema);
 	deserializer.ReadPropertyWithDefault<shared_ptr<ParquetEncryptionConfig>>(104, "encryption_config", result.encryption_config, nullptr);
+	deserializer.ReadPropertyWithDefault<string>(105, "manifest_path", result.manifest_path, "");
 	return result;
 }
 
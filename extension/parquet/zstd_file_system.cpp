@@ -172,6 +172,160 @@ unique_ptr<StreamWrapper> ZStdFileSystem::CreateStream() {
 	return make_uniq<ZstdStreamWrapper>();
 }
 
+static constexpr const uint32_t ZSTD_FRAME_MAGIC = 0xFD2FB528;
+static constexpr const uint32_t ZSTD_SKIPPABLE_FRAME_MAGIC = 0x184D2A50;
+static constexpr const uint32_t ZSTD_SKIPPABLE_FRAME_MAGIC_MASK = 0xFFFFFFF0;
+static constexpr const uint32_t ZSTD_SEEKABLE_MAGIC = 0x8F92EAB1;
+static constexpr const idx_t ZSTD_SEEKABLE_FOOTER_SIZE = 9;
+static constexpr const idx_t ZSTD_SKIPPABLE_HEADER_SIZE = 8;
+
+//! Reads the frames from the seek table of a file in the zstd seekable format
+static bool GetSeekableFrames(FileHandle &handle, idx_t file_size, vector<CompressedFrame> &frames) {
+	if (file_size < ZSTD_SKIPPABLE_HEADER_SIZE + ZSTD_SEEKABLE_FOOTER_SIZE) {
+		return false;
+	}
+	data_t footer[ZSTD_SEEKABLE_FOOTER_SIZE];
+	handle.Read(footer, ZSTD_SEEKABLE_FOOTER_SIZE, file_size - ZSTD_SEEKABLE_FOOTER_SIZE);
+	if (Load<uint32_t>(footer + 5) != ZSTD_SEEKABLE_MAGIC) {
+		return false;
+	}
+	auto frame_count = Load<uint32_t>(footer);
+	auto descriptor = footer[4];
+	idx_t entry_size = descriptor & 0x80 ? 12 : 8;
+	idx_t seek_table_size = ZSTD_SKIPPABLE_HEADER_SIZE + frame_count * entry_size + ZSTD_SEEKABLE_FOOTER_SIZE;
+	if (seek_table_size > file_size) {
+		return false;
+	}
+	auto seek_table_start = file_size - seek_table_size;
+	auto entries = make_unsafe_uniq_array<data_t>(frame_count * entry_size + 1);
+	handle.Read(entries.get(), frame_count * entry_size, seek_table_start + ZSTD_SKIPPABLE_HEADER_SIZE);
+	idx_t offset = 0;
+	for (idx_t frame_idx = 0; frame_idx < frame_count; frame_idx++) {
+		idx_t compressed_size = Load<uint32_t>(entries.get() + frame_idx * entry_size);
+		frames.push_back(CompressedFrame {offset, compressed_size});
+		offset += compressed_size;
+	}
+	return offset == seek_table_start;
+}
+
+//! Finds the frames of a zstd file by walking over the frame and block headers
+static bool WalkFrames(FileHandle &handle, idx_t file_size, vector<CompressedFrame> &frames) {
+	data_t header[18];
+	idx_t offset = 0;
+	while (offset < file_size) {
+		if (offset + 8 > file_size) {
+			return false;
+		}
+		handle.Read(header, 8, offset);
+		auto magic = Load<uint32_t>(header);
+		if ((magic & ZSTD_SKIPPABLE_FRAME_MAGIC_MASK) == ZSTD_SKIPPABLE_FRAME_MAGIC) {
+			// skippable frames (e.g. the seek table) do not contain any data
+			offset += ZSTD_SKIPPABLE_HEADER_SIZE + Load<uint32_t>(header + 4);
+			continue;
+		}
+		if (magic != ZSTD_FRAME_MAGIC) {
+			return false;
+		}
+		// the size of the frame header depends on its descriptor
+		auto descriptor = header[4];
+		auto content_size_flag = descriptor >> 6;
+		bool single_segment = descriptor & 0x20;
+		bool has_checksum = descriptor & 0x04;
+		static constexpr const idx_t DICTIONARY_ID_SIZES[] = {0, 1, 2, 4};
+		static constexpr const idx_t CONTENT_SIZE_SIZES[] = {0, 2, 4, 8};
+		idx_t content_size_size =
+		    content_size_flag == 0 && single_segment ? 1 : CONTENT_SIZE_SIZES[content_size_flag];
+		idx_t frame_header_size =
+		    1 + (single_segment ? 0 : 1) + DICTIONARY_ID_SIZES[descriptor & 0x03] + content_size_size;
+		auto frame_start = offset;
+		offset += sizeof(uint32_t) + frame_header_size;
+		// walk over the blocks of the frame
+		while (true) {
+			if (offset + 3 > file_size) {
+				return false;
+			}
+			handle.Read(header, 3, offset);
+			uint32_t block_header = header[0] | header[1] << 8 | header[2] << 16;
+			bool last_block = block_header & 1;
+			auto block_type = (block_header >> 1) & 3;
+			idx_t block_size = block_header >> 3;
+			if (block_type == 3) {
+				// reserved block type
+				return false;
+			}
+			// RLE blocks store a single byte
+			offset += 3 + (block_type == 1 ? 1 : block_size);
+			if (last_block) {
+				break;
+			}
+		}
+		if (has_checksum) {
+			offset += 4;
+		}
+		if (offset > file_size) {
+			return false;
+		}
+		frames.push_back(CompressedFrame {frame_start, offset - frame_start});
+	}
+	return true;
+}
+
+bool ZStdFileSystem::GetFrames(FileHandle &handle, vector<CompressedFrame> &frames) {
+	auto file_size = NumericCast<idx_t>(handle.GetFileSize());
+	if (GetSeekableFrames(handle, file_size, frames)) {
+		return true;
+	}
+	frames.clear();
+	return WalkFrames(handle, file_size, frames);
+}
+
+idx_t ZStdFileSystem::DecompressFrame(const_data_ptr_t input, idx_t input_size, unsafe_unique_array<data_t> &output,
+                                      idx_t &output_capacity) {
+	auto content_size = duckdb_zstd::ZSTD_getFrameContentSize(input, input_size);
+	if (content_size == ZSTD_CONTENTSIZE_ERROR) {
+		throw IOException("Failed to decode zstd frame: invalid frame header");
+	}
+	if (content_size != ZSTD_CONTENTSIZE_UNKNOWN) {
+		// the frame stores its decompressed size: decompress it at once
+		if (content_size > output_capacity) {
+			output = make_unsafe_uniq_array<data_t>(content_size);
+			output_capacity = content_size;
+		}
+		auto res = duckdb_zstd::ZSTD_decompress(output.get(), content_size, input, input_size);
+		if (duckdb_zstd::ZSTD_isError(res)) {
+			throw IOException(duckdb_zstd::ZSTD_getErrorName(res));
+		}
+		return res;
+	}
+	// otherwise stream the frame into the output buffer, growing it as required
+	auto dstream = duckdb_zstd::ZSTD_createDStream();
+	duckdb_zstd::ZSTD_inBuffer in_buffer {input, input_size, 0};
+	idx_t output_size = 0;
+	while (true) {
+		if (output_size == output_capacity) {
+			auto new_capacity = MaxValue<idx_t>(output_capacity * 2, duckdb_zstd::ZSTD_DStreamOutSize());
+			auto new_output = make_unsafe_uniq_array<data_t>(new_capacity);
+			if (output_size > 0) {
+				memcpy(new_output.get(), output.get(), output_size);
+			}
+			output = std::move(new_output);
+			output_capacity = new_capacity;
+		}
+		duckdb_zstd::ZSTD_outBuffer out_buffer {output.get(), output_capacity, output_size};
+		auto res = duckdb_zstd::ZSTD_decompressStream(dstream, &out_buffer, &in_buffer);
+		if (duckdb_zstd::ZSTD_isError(res)) {
+			duckdb_zstd::ZSTD_freeDStream(dstream);
+			throw IOException(duckdb_zstd::ZSTD_getErrorName(res));
+		}
+		output_size = out_buffer.pos;
+		if (res == 0 || (in_buffer.pos == in_buffer.size && out_buffer.pos < out_buffer.size)) {
+			break;
+		}
+	}
+	duckdb_zstd::ZSTD_freeDStream(dstream);
+	return output_size;
+}
+
 idx_t ZStdFileSystem::InBufferSize() {
 	return duckdb_zstd::ZSTD_DStreamInSize();
 }
@@ -19,7 +19,7 @@ namespace duckdb {
 
 TableCatalogEntry::TableCatalogEntry(Catalog &catalog, SchemaCatalogEntry &schema, CreateTableInfo &info)
     : StandardEntry(CatalogType::TABLE_ENTRY, schema, catalog, info.table), columns(std::move(info.columns)),
-      constraints(std::move(info.constraints)) {
+      constraints(std::move(info.constraints)), cluster_by(info.cluster_by) {
 	this->temporary = info.temporary;
 	this->comment = info.comment;
 }
@@ -65,9 +65,27 @@ unique_ptr<CreateInfo> TableCatalogEntry::GetInfo() const {
 	std::for_each(constraints.begin(), constraints.end(),
 	              [&result](const unique_ptr<Constraint> &c) { result->constraints.emplace_back(c->Copy()); });
 	result->comment = comment;
+	result->cluster_by = cluster_by;
 	return std::move(result);
 }
 
+const vector<string> &TableCatalogEntry::GetClusterBy() const {
+	return cluster_by;
+}
+
+void TableCatalogEntry::BindClusterBy(const ColumnList &columns, vector<string> &cluster_by) {
+	for (auto &name : cluster_by) {
+		if (!columns.ColumnExists(name)) {
+			throw BinderException("Cluster key column \"%s\" does not exist", name);
+		}
+		auto &column = columns.GetColumn(name);
+		if (column.Generated()) {
+			throw BinderException("Cluster key column \"%s\" cannot be a generated column", name);
+		}
+		name = column.Name();
+	}
+}
+
 string TableCatalogEntry::ColumnsToSQL(const ColumnList &columns, const vector<unique_ptr<Constraint>> &constraints) {
 	std::stringstream ss;
 
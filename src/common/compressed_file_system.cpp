@@ -1,10 +1,217 @@
 #include "duckdb/common/compressed_file_system.hpp"
+#include "duckdb/common/error_data.hpp"
+#include "duckdb/common/map.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/set.hpp"
+#include "duckdb/common/thread.hpp"
+
+#include <condition_variable>
 
 namespace duckdb {
 
 StreamWrapper::~StreamWrapper() {
 }
 
+//! Decompresses a compressed file ahead of its reader on background threads. The decompressed data is handed to the
+//! reader in chunks: one chunk per frame if the file consists of frames that can be decompressed independently (and in
+//! parallel), or chunks of the decompressed stream otherwise.
+class CompressedFileReadAhead {
+public:
+	//! The size of the chunks of the decompressed stream
+	static constexpr const idx_t STREAM_CHUNK_SIZE = 1ULL << 20ULL;
+	//! The number of chunks (per thread) that can be decompressed ahead of the reader
+	static constexpr const idx_t CHUNKS_PER_THREAD = 4;
+
+	CompressedFileReadAhead(CompressedFile &file, vector<CompressedFrame> frames_p, idx_t thread_count)
+	    : file(file), frames(std::move(frames_p)) {
+		if (frames.empty()) {
+			thread_count = 1;
+		}
+		max_chunks_ahead = thread_count * CHUNKS_PER_THREAD;
+		for (idx_t thread_idx = 0; thread_idx < thread_count; thread_idx++) {
+			threads.emplace_back([this]() { frames.empty() ? DecompressStream() : DecompressFrames(); });
+		}
+	}
+
+	~CompressedFileReadAhead() {
+		{
+			lock_guard<mutex> guard(lock);
+			stopped = true;
+		}
+		chunk_consumed.notify_all();
+		for (auto &read_ahead_thread : threads) {
+			read_ahead_thread.join();
+		}
+	}
+
+	int64_t Read(data_ptr_t buffer, idx_t nr_bytes) {
+		idx_t total_read = 0;
+		unique_lock<mutex> guard(lock);
+		while (total_read < nr_bytes) {
+			chunk_ready.wait(guard, [&]() {
+				return error.HasError() || chunks.find(read_chunk_idx) != chunks.end() || Finished();
+			});
+			if (error.HasError()) {
+				error.Throw();
+			}
+			auto entry = chunks.find(read_chunk_idx);
+			if (entry == chunks.end()) {
+				// all chunks have been read
+				break;
+			}
+			auto &chunk = entry->second;
+			auto available = MinValue<idx_t>(nr_bytes - total_read, chunk.size - chunk_offset);
+			memcpy(buffer + total_read, chunk.data.get() + chunk_offset, available);
+			total_read += available;
+			chunk_offset += available;
+			if (chunk_offset == chunk.size) {
+				chunks.erase(entry);
+				read_chunk_idx++;
+				chunk_offset = 0;
+				SkipEmptyChunks();
+				chunk_consumed.notify_all();
+			}
+		}
+		return NumericCast<int64_t>(total_read);
+	}
+
+private:
+	struct DecompressedChunk {
+		unsafe_unique_array<data_t> data;
+		idx_t size = 0;
+	};
+
+	bool Finished() const {
+		return chunk_count.IsValid() && read_chunk_idx >= chunk_count.GetIndex();
+	}
+
+	//! Waits until the chunk may be decompressed, returns false if the read ahead was stopped
+	bool WaitForChunk(unique_lock<mutex> &guard, idx_t chunk_idx) {
+		chunk_consumed.wait(guard, [&]() { return stopped || chunk_idx < read_chunk_idx + max_chunks_ahead; });
+		return !stopped;
+	}
+
+	//! Moves the reader past the empty chunks, must be called with the lock held
+	void SkipEmptyChunks() {
+		while (empty_chunks.find(read_chunk_idx) != empty_chunks.end()) {
+			empty_chunks.erase(read_chunk_idx);
+			read_chunk_idx++;
+		}
+	}
+
+	void AddChunk(idx_t chunk_idx, DecompressedChunk chunk) {
+		{
+			lock_guard<mutex> guard(lock);
+			if (chunk.size > 0) {
+				chunks[chunk_idx] = std::move(chunk);
+			} else {
+				// skip over empty chunks (e.g. frames that do not contain any data)
+				empty_chunks.insert(chunk_idx);
+			}
+			SkipEmptyChunks();
+		}
+		chunk_ready.notify_all();
+		chunk_consumed.notify_all();
+	}
+
+	void SetError(ErrorData error_p) {
+		{
+			lock_guard<mutex> guard(lock);
+			error = std::move(error_p);
+		}
+		chunk_ready.notify_all();
+	}
+
+	//! Runs the stream decoder of the file ahead of the reader
+	void DecompressStream() {
+		try {
+			for (idx_t chunk_idx = 0;; chunk_idx++) {
+				{
+					unique_lock<mutex> guard(lock);
+					if (!WaitForChunk(guard, chunk_idx)) {
+						return;
+					}
+				}
+				DecompressedChunk chunk;
+				chunk.data = make_unsafe_uniq_array<data_t>(STREAM_CHUNK_SIZE);
+				chunk.size = NumericCast<idx_t>(file.ReadStream(chunk.data.get(), STREAM_CHUNK_SIZE));
+				if (chunk.size == 0) {
+					{
+						lock_guard<mutex> guard(lock);
+						chunk_count = chunk_idx;
+					}
+					chunk_ready.notify_all();
+					return;
+				}
+				AddChunk(chunk_idx, std::move(chunk));
+			}
+		} catch (std::exception &ex) {
+			SetError(ErrorData(ex));
+		}
+	}
+
+	//! Decompresses the frames of the file in parallel with the other threads
+	void DecompressFrames() {
+		try {
+			unsafe_unique_array<data_t> input;
+			idx_t input_capacity = 0;
+			while (true) {
+				idx_t frame_idx;
+				{
+					unique_lock<mutex> guard(lock);
+					if (next_frame_idx >= frames.size()) {
+						chunk_count = frames.size();
+						break;
+					}
+					frame_idx = next_frame_idx++;
+					if (!WaitForChunk(guard, frame_idx)) {
+						return;
+					}
+				}
+				auto &frame = frames[frame_idx];
+				if (frame.size > input_capacity) {
+					input_capacity = frame.size;
+					input = make_unsafe_uniq_array<data_t>(input_capacity);
+				}
+				file.child_handle->Read(input.get(), frame.size, frame.offset);
+				DecompressedChunk chunk;
+				idx_t capacity = 0;
+				chunk.size = file.compressed_fs.DecompressFrame(input.get(), frame.size, chunk.data, capacity);
+				AddChunk(frame_idx, std::move(chunk));
+			}
+		} catch (std::exception &ex) {
+			SetError(ErrorData(ex));
+			return;
+		}
+		chunk_ready.notify_all();
+	}
+
+private:
+	CompressedFile &file;
+	//! The frames of the file, or empty if the stream is decompressed
+	vector<CompressedFrame> frames;
+	vector<thread> threads;
+
+	mutex lock;
+	std::condition_variable chunk_ready;
+	std::condition_variable chunk_consumed;
+	//! The decompressed chunks that have not been read yet
+	map<idx_t, DecompressedChunk> chunks;
+	//! The chunks that were empty, and that can be skipped by the reader
+	set<idx_t> empty_chunks;
+	//! The chunk that is read next, and the offset within it
+	idx_t read_chunk_idx = 0;
+	idx_t chunk_offset = 0;
+	//! The next frame to decompress
+	idx_t next_frame_idx = 0;
+	//! How many chunks can be decompressed ahead of the reader
+	idx_t max_chunks_ahead;
+	//! The total number of chunks, once known
+	optional_idx chunk_count;
+	bool stopped = false;
+	ErrorData error;
+};
+
 CompressedFile::CompressedFile(CompressedFileSystem &fs, unique_ptr<FileHandle> child_handle_p, const string &path)
     : FileHandle(fs, path), compressed_fs(fs), child_handle(std::move(child_handle_p)) {
 	D_ASSERT(child_handle->SeekPosition() == 0);
@@ -14,6 +221,20 @@ CompressedFile::~CompressedFile() {
 	CompressedFile::Close();
 }
 
+void CompressedFile::StartReadAhead(idx_t thread_count) {
+	D_ASSERT(!write);
+	read_ahead.reset();
+	read_ahead_threads = thread_count;
+	if (read_ahead_threads == 0) {
+		return;
+	}
+	vector<CompressedFrame> frames;
+	if (!child_handle->OnDiskFile() || !compressed_fs.GetFrames(*child_handle, frames) || frames.size() < 2) {
+		frames.clear();
+	}
+	read_ahead = make_uniq<CompressedFileReadAhead>(*this, std::move(frames), read_ahead_threads);
+}
+
 void CompressedFile::Initialize(bool write) {
 	Close();
 
@@ -29,9 +250,19 @@ void CompressedFile::Initialize(bool write) {
 
 	stream_wrapper = compressed_fs.CreateStream();
 	stream_wrapper->Initialize(*this, write);
+	if (!write && read_ahead_threads > 0) {
+		StartReadAhead(read_ahead_threads);
+	}
+}
+
+int64_t CompressedFile::ReadData(void *buffer, int64_t nr_bytes) {
+	if (read_ahead) {
+		return read_ahead->Read(data_ptr_cast(buffer), NumericCast<idx_t>(nr_bytes));
+	}
+	return ReadStream(buffer, nr_bytes);
 }
 
-int64_t CompressedFile::ReadData(void *buffer, int64_t remaining) {
+int64_t CompressedFile::ReadStream(void *buffer, int64_t remaining) {
 	idx_t total_read = 0;
 	while (true) {
 		// first check if there are input bytes available in the output buffers
@@ -101,6 +332,8 @@ int64_t CompressedFile::WriteData(data_ptr_t buffer, int64_t nr_bytes) {
 }
 
 void CompressedFile::Close() {
+	// stop reading ahead before the stream is closed
+	read_ahead.reset();
 	if (stream_wrapper) {
 		stream_wrapper->Close();
 		stream_wrapper.reset();
@@ -146,4 +379,13 @@ bool CompressedFileSystem::CanSeek() {
 	return false;
 }
 
+bool CompressedFileSystem::GetFrames(FileHandle &handle, vector<CompressedFrame> &frames) {
+	return false;
+}
+
+idx_t CompressedFileSystem::DecompressFrame(const_data_ptr_t input, idx_t input_size,
+                                            unsafe_unique_array<data_t> &output, idx_t &output_capacity) {
+	throw InternalException("DecompressFrame is not implemented for %s", GetName());
+}
+
 } // namespace duckdb
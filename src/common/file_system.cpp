@@ -54,6 +54,7 @@ constexpr FileOpenFlags FileFlags::FILE_FLAGS_APPEND;
 constexpr FileOpenFlags FileFlags::FILE_FLAGS_PRIVATE;
 constexpr FileOpenFlags FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS;
 constexpr FileOpenFlags FileFlags::FILE_FLAGS_PARALLEL_ACCESS;
+constexpr FileOpenFlags FileFlags::FILE_FLAGS_PARALLEL_DECOMPRESSION;
 
 void FileOpenFlags::Verify() {
 #ifdef DEBUG
@@ -77,6 +78,8 @@ void FileOpenFlags::Verify() {
 	D_ASSERT(!is_private || is_create);
 	// FILE_FLAGS_NULL_IF_NOT_EXISTS cannot be combined with CREATE/CREATE_NEW
 	D_ASSERT(!(null_if_not_exists && is_create));
+	// only files that are read can be decompressed in parallel
+	D_ASSERT(!is_write || !(flags & FileOpenFlags::FILE_FLAGS_PARALLEL_DECOMPRESSION));
 #endif
 }
 
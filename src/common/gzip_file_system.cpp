@@ -378,6 +378,98 @@ string GZipFileSystem::UncompressGZIPString(const string &in) {
 	return decompressed;
 }
 
+bool GZipFileSystem::GetFrames(FileHandle &handle, vector<CompressedFrame> &frames) {
+	// the members of BGZF files (e.g. as written by bgzip) store their compressed size in the "BC" extra subfield
+	auto file_size = NumericCast<idx_t>(handle.GetFileSize());
+	uint8_t gzip_hdr[GZIP_HEADER_MINSIZE + 2];
+	auto extra_field = make_unsafe_uniq_array<uint8_t>(NumericLimits<uint16_t>::Maximum());
+	idx_t offset = 0;
+	while (offset < file_size) {
+		if (offset + sizeof(gzip_hdr) > file_size) {
+			return false;
+		}
+		handle.Read(gzip_hdr, sizeof(gzip_hdr), offset);
+		if (gzip_hdr[0] != 0x1F || gzip_hdr[1] != 0x8B || gzip_hdr[2] != GZIP_COMPRESSION_DEFLATE ||
+		    (gzip_hdr[3] & GZIP_FLAG_UNSUPPORTED) || !(gzip_hdr[3] & GZIP_FLAG_EXTRA)) {
+			return false;
+		}
+		idx_t xlen = (uint8_t)gzip_hdr[10] | (uint8_t)gzip_hdr[11] << 8;
+		if (offset + sizeof(gzip_hdr) + xlen > file_size) {
+			return false;
+		}
+		handle.Read(extra_field.get(), xlen, offset + sizeof(gzip_hdr));
+		idx_t member_size = 0;
+		for (idx_t pos = 0; pos + 4 <= xlen;) {
+			idx_t subfield_length = extra_field[pos + 2] | extra_field[pos + 3] << 8;
+			if (extra_field[pos] == 'B' && extra_field[pos + 1] == 'C' && subfield_length == 2 && pos + 6 <= xlen) {
+				member_size = (extra_field[pos + 4] | extra_field[pos + 5] << 8) + 1;
+			}
+			pos += 4 + subfield_length;
+		}
+		if (member_size == 0 || offset + member_size > file_size) {
+			return false;
+		}
+		frames.push_back(CompressedFrame {offset, member_size});
+		offset += member_size;
+	}
+	return true;
+}
+
+idx_t GZipFileSystem::DecompressFrame(const_data_ptr_t input, idx_t input_size, unsafe_unique_array<data_t> &output,
+                                      idx_t &output_capacity) {
+	if (input_size < GZIP_HEADER_MINSIZE + GZIP_FOOTER_SIZE) {
+		throw IOException("Input is not a GZIP stream");
+	}
+	uint8_t gzip_hdr[GZIP_HEADER_MINSIZE];
+	memcpy(gzip_hdr, input, GZIP_HEADER_MINSIZE);
+	VerifyGZIPHeader(gzip_hdr, GZIP_HEADER_MINSIZE);
+	idx_t data_start = GZIP_HEADER_MINSIZE;
+	if (gzip_hdr[3] & GZIP_FLAG_EXTRA) {
+		if (data_start + 2 > input_size) {
+			throw IOException("Input is not a GZIP stream");
+		}
+		idx_t xlen = (uint8_t)input[data_start] | (uint8_t)input[data_start + 1] << 8;
+		data_start += xlen + 2;
+	}
+	if (gzip_hdr[3] & GZIP_FLAG_NAME) {
+		while (data_start < input_size && input[data_start] != '\0') {
+			data_start++;
+		}
+		data_start++;
+	}
+	if (data_start + GZIP_FOOTER_SIZE > input_size) {
+		throw IOException("Input is not a GZIP stream");
+	}
+	// the footer of the member stores its uncompressed size (modulo 2^32, but members that are found are small)
+	auto footer = input + input_size - GZIP_FOOTER_SIZE;
+	idx_t uncompressed_size = Load<uint32_t>(footer + 4);
+	if (uncompressed_size == 0) {
+		return 0;
+	}
+	if (uncompressed_size > output_capacity) {
+		output = make_unsafe_uniq_array<data_t>(uncompressed_size);
+		output_capacity = uncompressed_size;
+	}
+
+	duckdb_miniz::mz_stream mz_stream;
+	memset(&mz_stream, 0, sizeof(duckdb_miniz::mz_stream));
+	auto ret = duckdb_miniz::mz_inflateInit2(&mz_stream, -MZ_DEFAULT_WINDOW_BITS);
+	if (ret != duckdb_miniz::MZ_OK) {
+		throw InternalException("Failed to initialize miniz");
+	}
+	mz_stream.next_in = input + data_start;
+	mz_stream.avail_in = NumericCast<uint32_t>(input_size - data_start - GZIP_FOOTER_SIZE);
+	mz_stream.next_out = output.get();
+	mz_stream.avail_out = NumericCast<uint32_t>(uncompressed_size);
+	ret = duckdb_miniz::mz_inflate(&mz_stream, duckdb_miniz::MZ_FINISH);
+	auto decompressed_size = mz_stream.total_out;
+	duckdb_miniz::mz_inflateEnd(&mz_stream);
+	if (ret != duckdb_miniz::MZ_STREAM_END || decompressed_size != uncompressed_size) {
+		throw IOException("Failed to decode gzip stream: %s", duckdb_miniz::mz_error(ret));
+	}
+	return uncompressed_size;
+}
+
 unique_ptr<FileHandle> GZipFileSystem::OpenCompressedFile(unique_ptr<FileHandle> handle, bool write) {
 	auto path = handle->path;
 	return make_uniq<GZipFile>(std::move(handle), path, write);
@@ -1,7 +1,9 @@
 #include "duckdb/common/virtual_file_system.hpp"
 #include "duckdb/common/gzip_file_system.hpp"
 #include "duckdb/common/pipe_file_system.hpp"
+#include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/value.hpp"
 
 namespace duckdb {
 
@@ -42,6 +44,15 @@ unique_ptr<FileHandle> VirtualFileSystem::OpenFile(const string &path, FileOpenF
 			    "Attempting to open a compressed file, but the compression type is not supported");
 		}
 		file_handle = entry->second->OpenCompressedFile(std::move(file_handle), flags.OpenForWriting());
+		if (flags.ParallelDecompression() && !flags.OpenForWriting()) {
+			// decompress the file ahead of the reader with (up to) as many threads as the query may use
+			Value threads_setting;
+			idx_t thread_count = 1;
+			if (FileOpener::TryGetCurrentSetting(opener, "threads", threads_setting) && !threads_setting.IsNull()) {
+				thread_count = MaxValue<idx_t>(threads_setting.GetValue<int64_t>(), 1);
+			}
+			file_handle->Cast<CompressedFile>().StartReadAhead(thread_count);
+		}
 	}
 	return file_handle;
 }
@@ -3,6 +3,8 @@
 #include "duckdb/execution/operator/csv_scanner/skip_scanner.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_file_scanner.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/common/operator/integer_cast_operator.hpp"
 #include "duckdb/common/operator/double_cast_operator.hpp"
 #include <algorithm>
@@ -49,9 +51,13 @@ StringValueResult::StringValueResult(CSVStates &states, CSVStateMachine &state_m
 			    "Mismatch between the number of columns (%d) in the CSV file and what is expected in the scanner (%d).",
 			    number_of_columns, csv_file_scan->file_types.size());
 		}
+		bool filter_before_cast = csv_file_scan->FilterBeforeCast();
 		for (idx_t i = 0; i < csv_file_scan->file_types.size(); i++) {
 			auto &type = csv_file_scan->file_types[i];
-			if (StringValueScanner::CanDirectlyCast(type, state_machine.options.dialect_options.date_format)) {
+			// numeric columns that are not filtered on are only cast for the rows that pass the filters
+			bool defer_cast = filter_before_cast && type.IsNumeric() && !csv_file_scan->HasFilter(i);
+			if (!defer_cast &&
+			    StringValueScanner::CanDirectlyCast(type, state_machine.options.dialect_options.date_format)) {
 				parse_types[i] = {type.id(), true};
 				logical_types.emplace_back(type);
 			} else {
@@ -547,6 +553,137 @@ StringValueResult &StringValueScanner::ParseChunk() {
 	return result;
 }
 
+void StringValueScanner::CastColumn(idx_t col_idx, DataChunk &parse_chunk, DataChunk &insert_chunk,
+                                    optional_ptr<SelectionVector> row_sel, unordered_set<idx_t> &borked_lines) {
+	if (col_idx >= parse_chunk.ColumnCount()) {
+		throw InvalidInputException("Mismatch between the schema of different files");
+	}
+	// if rows were filtered out already, only the remaining rows are cast
+	auto count = insert_chunk.size();
+	Vector parse_vector(parse_chunk.data[col_idx]);
+	if (row_sel) {
+		parse_vector.Slice(*row_sel, count);
+	}
+	auto &result_vector = insert_chunk.data[csv_file_scan->GetResultIndex(col_idx)];
+	auto &type = result_vector.GetType();
+	auto &parse_type = parse_vector.GetType();
+	if (type == LogicalType::VARCHAR || (type != LogicalType::VARCHAR && parse_type != LogicalType::VARCHAR)) {
+		// reinterpret rather than reference
+		result_vector.Reinterpret(parse_vector);
+		return;
+	}
+	string error_message;
+	CastParameters parameters(false, &error_message);
+	bool success;
+	idx_t line_error = 0;
+	bool line_error_set = true;
+
+	if (!state_machine->options.dialect_options.date_format.at(LogicalTypeId::DATE).GetValue().Empty() &&
+	    type.id() == LogicalTypeId::DATE) {
+		// use the date format to cast the chunk
+		success = CSVCast::TryCastDateVector(state_machine->options.dialect_options.date_format, parse_vector,
+		                                     result_vector, count, parameters, line_error, true);
+	} else if (!state_machine->options.dialect_options.date_format.at(LogicalTypeId::TIMESTAMP).GetValue().Empty() &&
+	           type.id() == LogicalTypeId::TIMESTAMP) {
+		// use the date format to cast the chunk
+		success = CSVCast::TryCastTimestampVector(state_machine->options.dialect_options.date_format, parse_vector,
+		                                          result_vector, count, parameters, true);
+	} else if (state_machine->options.decimal_separator != "." &&
+	           (type.id() == LogicalTypeId::FLOAT || type.id() == LogicalTypeId::DOUBLE)) {
+		success = CSVCast::TryCastFloatingVectorCommaSeparated(state_machine->options, parse_vector, result_vector,
+		                                                       count, parameters, type, line_error);
+	} else if (state_machine->options.decimal_separator != "." && type.id() == LogicalTypeId::DECIMAL) {
+		success = CSVCast::TryCastDecimalVectorCommaSeparated(state_machine->options, parse_vector, result_vector,
+		                                                      count, parameters, type, line_error);
+
+	} else {
+		// target type is not varchar: perform a cast
+		success = VectorOperations::TryCast(buffer_manager->context, parse_vector, result_vector, count,
+		                                    &error_message, false, true);
+		line_error_set = false;
+	}
+	if (success) {
+		return;
+	}
+	// An error happened, to propagate it we need to figure out the exact line where the casting failed.
+	UnifiedVectorFormat inserted_column_data;
+	result_vector.ToUnifiedFormat(count, inserted_column_data);
+	UnifiedVectorFormat parse_column_data;
+	parse_vector.ToUnifiedFormat(count, parse_column_data);
+	if (!line_error_set) {
+		for (; line_error < count; line_error++) {
+			if (!inserted_column_data.validity.RowIsValid(line_error) &&
+			    parse_column_data.validity.RowIsValid(line_error)) {
+				break;
+			}
+		}
+	}
+	// the line of the row in the parsed chunk, and the column in the file
+	auto parsed_row = row_sel ? row_sel->get_index(line_error) : line_error;
+	auto &projection_ids = csv_file_scan->projection_ids;
+	auto file_col_idx = projection_ids.empty() ? col_idx : projection_ids[col_idx].first;
+	{
+		vector<Value> row;
+
+		if (state_machine->options.ignore_errors) {
+			for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
+				row.push_back(parse_chunk.GetValue(col, parsed_row));
+			}
+		}
+
+		LinesPerBoundary lines_per_batch(iterator.GetBoundaryIdx(), lines_read - parse_chunk.size() + parsed_row);
+		auto csv_error =
+		    CSVError::CastError(state_machine->options, csv_file_scan->names[file_col_idx], error_message, file_col_idx,
+		                        row, lines_per_batch, result_vector.GetType().id());
+		error_handler->Error(csv_error);
+	}
+	borked_lines.insert(line_error++);
+	D_ASSERT(state_machine->options.ignore_errors);
+	// We are ignoring errors. We must continue but ignoring borked rows
+	for (; line_error < count; line_error++) {
+		if (!inserted_column_data.validity.RowIsValid(line_error) &&
+		    parse_column_data.validity.RowIsValid(line_error)) {
+			borked_lines.insert(line_error);
+			vector<Value> row;
+			for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
+				row.push_back(parse_chunk.GetValue(col, line_error));
+			}
+			LinesPerBoundary lines_per_batch(iterator.GetBoundaryIdx(),
+			                                 lines_read - parse_chunk.size() + line_error);
+			auto csv_error = CSVError::CastError(state_machine->options, csv_file_scan->names[file_col_idx],
+			                                     error_message, file_col_idx, row, lines_per_batch,
+			                                     result_vector.GetType().id());
+
+			error_handler->Error(csv_error);
+		}
+	}
+}
+
+idx_t StringValueScanner::ApplyFilters(DataChunk &insert_chunk, SelectionVector &sel) {
+	auto &reader_data = csv_file_scan->reader_data;
+	auto count = insert_chunk.size();
+	sel.Initialize(nullptr);
+	idx_t approved_tuple_count = count;
+	for (auto &entry : reader_data.filters->filters) {
+		if (approved_tuple_count == 0) {
+			break;
+		}
+		auto &filter_entry = reader_data.filter_map[entry.first];
+		UnifiedVectorFormat vdata;
+		if (filter_entry.is_constant) {
+			// the column is a constant (e.g. a hive partition), check the constant
+			Vector constant_vector(reader_data.constant_map[filter_entry.index].value);
+			constant_vector.ToUnifiedFormat(count, vdata);
+			ColumnSegment::FilterSelection(sel, constant_vector, vdata, *entry.second, count, approved_tuple_count);
+		} else {
+			auto &filter_vector = insert_chunk.data[entry.first];
+			filter_vector.ToUnifiedFormat(count, vdata);
+			ColumnSegment::FilterSelection(sel, filter_vector, vdata, *entry.second, count, approved_tuple_count);
+		}
+	}
+	return approved_tuple_count;
+}
+
 void StringValueScanner::Flush(DataChunk &insert_chunk) {
 	auto &process_result = ParseChunk();
 	// First Get Parsed Chunk
@@ -565,113 +702,41 @@ void StringValueScanner::Flush(DataChunk &insert_chunk) {
 	D_ASSERT(csv_file_scan);
 
 	auto &reader_data = csv_file_scan->reader_data;
-	// Now Do the cast-aroo
+	auto &filters = reader_data.filters;
+	// If possible, the columns that are filtered on are cast first, and the rows that do not pass the filters are
+	// removed before the other columns are cast. Otherwise, the filters are applied to the cast chunk.
+	bool filter_before_cast = csv_file_scan->FilterBeforeCast();
+	vector<idx_t> filter_columns;
+	vector<idx_t> other_columns;
 	for (idx_t c = 0; c < reader_data.column_ids.size(); c++) {
-		idx_t col_idx = c;
-		idx_t result_idx = reader_data.column_mapping[c];
-		if (!csv_file_scan->projection_ids.empty()) {
-			result_idx = reader_data.column_mapping[csv_file_scan->projection_ids[c].second];
-		}
-		if (col_idx >= parse_chunk.ColumnCount()) {
-			throw InvalidInputException("Mismatch between the schema of different files");
-		}
-		auto &parse_vector = parse_chunk.data[col_idx];
-		auto &result_vector = insert_chunk.data[result_idx];
-		auto &type = result_vector.GetType();
-		auto &parse_type = parse_vector.GetType();
-		if (type == LogicalType::VARCHAR || (type != LogicalType::VARCHAR && parse_type != LogicalType::VARCHAR)) {
-			// reinterpret rather than reference
-			result_vector.Reinterpret(parse_vector);
+		if (filter_before_cast && csv_file_scan->HasFilter(c)) {
+			filter_columns.push_back(c);
 		} else {
-			string error_message;
-			CastParameters parameters(false, &error_message);
-			bool success;
-			idx_t line_error = 0;
-			bool line_error_set = true;
-
-			if (!state_machine->options.dialect_options.date_format.at(LogicalTypeId::DATE).GetValue().Empty() &&
-			    type.id() == LogicalTypeId::DATE) {
-				// use the date format to cast the chunk
-				success = CSVCast::TryCastDateVector(state_machine->options.dialect_options.date_format, parse_vector,
-				                                     result_vector, parse_chunk.size(), parameters, line_error, true);
-			} else if (!state_machine->options.dialect_options.date_format.at(LogicalTypeId::TIMESTAMP)
-			                .GetValue()
-			                .Empty() &&
-			           type.id() == LogicalTypeId::TIMESTAMP) {
-				// use the date format to cast the chunk
-				success =
-				    CSVCast::TryCastTimestampVector(state_machine->options.dialect_options.date_format, parse_vector,
-				                                    result_vector, parse_chunk.size(), parameters, true);
-			} else if (state_machine->options.decimal_separator != "." &&
-			           (type.id() == LogicalTypeId::FLOAT || type.id() == LogicalTypeId::DOUBLE)) {
-				success =
-				    CSVCast::TryCastFloatingVectorCommaSeparated(state_machine->options, parse_vector, result_vector,
-				                                                 parse_chunk.size(), parameters, type, line_error);
-			} else if (state_machine->options.decimal_separator != "." && type.id() == LogicalTypeId::DECIMAL) {
-				success =
-				    CSVCast::TryCastDecimalVectorCommaSeparated(state_machine->options, parse_vector, result_vector,
-				                                                parse_chunk.size(), parameters, type, line_error);
-
-			} else {
-				// target type is not varchar: perform a cast
-				success = VectorOperations::TryCast(buffer_manager->context, parse_vector, result_vector,
-				                                    parse_chunk.size(), &error_message, false, true);
-				line_error_set = false;
-			}
-			if (success) {
-				continue;
-			}
-			// An error happened, to propagate it we need to figure out the exact line where the casting failed.
-			UnifiedVectorFormat inserted_column_data;
-			result_vector.ToUnifiedFormat(parse_chunk.size(), inserted_column_data);
-			UnifiedVectorFormat parse_column_data;
-			parse_vector.ToUnifiedFormat(parse_chunk.size(), parse_column_data);
-			if (!line_error_set) {
-				for (; line_error < parse_chunk.size(); line_error++) {
-					if (!inserted_column_data.validity.RowIsValid(line_error) &&
-					    parse_column_data.validity.RowIsValid(line_error)) {
-						break;
-					}
-				}
-			}
-			{
-				vector<Value> row;
-
-				if (state_machine->options.ignore_errors) {
-					for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
-						row.push_back(parse_chunk.GetValue(col, line_error));
-					}
-				}
-
-				LinesPerBoundary lines_per_batch(iterator.GetBoundaryIdx(),
-				                                 lines_read - parse_chunk.size() + line_error);
-				auto csv_error =
-				    CSVError::CastError(state_machine->options, csv_file_scan->names[col_idx], error_message, col_idx,
-				                        row, lines_per_batch, result_vector.GetType().id());
-				error_handler->Error(csv_error);
-			}
-			borked_lines.insert(line_error++);
-			D_ASSERT(state_machine->options.ignore_errors);
-			// We are ignoring errors. We must continue but ignoring borked rows
-			for (; line_error < parse_chunk.size(); line_error++) {
-				if (!inserted_column_data.validity.RowIsValid(line_error) &&
-				    parse_column_data.validity.RowIsValid(line_error)) {
-					borked_lines.insert(line_error);
-					vector<Value> row;
-					for (idx_t col = 0; col < parse_chunk.ColumnCount(); col++) {
-						row.push_back(parse_chunk.GetValue(col, line_error));
-					}
-					LinesPerBoundary lines_per_batch(iterator.GetBoundaryIdx(),
-					                                 lines_read - parse_chunk.size() + line_error);
-					auto csv_error =
-					    CSVError::CastError(state_machine->options, csv_file_scan->names[col_idx], error_message,
-					                        col_idx, row, lines_per_batch, result_vector.GetType().id());
-
-					error_handler->Error(csv_error);
-				}
+			other_columns.push_back(c);
+		}
+	}
+	// Now Do the cast-aroo
+	for (auto col_idx : filter_columns) {
+		CastColumn(col_idx, parse_chunk, insert_chunk, nullptr, borked_lines);
+	}
+	SelectionVector sel;
+	optional_ptr<SelectionVector> row_sel;
+	if (filter_before_cast) {
+		auto approved_tuple_count = ApplyFilters(insert_chunk, sel);
+		if (approved_tuple_count != insert_chunk.size()) {
+			for (auto col_idx : filter_columns) {
+				insert_chunk.data[csv_file_scan->GetResultIndex(col_idx)].Slice(sel, approved_tuple_count);
 			}
+			insert_chunk.SetCardinality(approved_tuple_count);
+			row_sel = &sel;
+		}
+		if (approved_tuple_count == 0) {
+			return;
 		}
 	}
+	for (auto col_idx : other_columns) {
+		CastColumn(col_idx, parse_chunk, insert_chunk, row_sel, borked_lines);
+	}
 	if (!borked_lines.empty()) {
 		// We must remove the borked lines from our chunk
 		SelectionVector succesful_rows(parse_chunk.size() - borked_lines.size());
@@ -684,6 +749,12 @@ void StringValueScanner::Flush(DataChunk &insert_chunk) {
 		// Now we slice the result
 		insert_chunk.Slice(succesful_rows, sel_idx);
 	}
+	if (filters && !filter_before_cast) {
+		auto approved_tuple_count = ApplyFilters(insert_chunk, sel);
+		if (approved_tuple_count != insert_chunk.size()) {
+			insert_chunk.Slice(sel, approved_tuple_count);
+		}
+	}
 }
 
 void StringValueScanner::Initialize() {
@@ -7,7 +7,7 @@ namespace duckdb {
 CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> buffer_manager_p,
                          shared_ptr<CSVStateMachine> state_machine_p, const CSVReaderOptions &options_p,
                          const ReadCSVData &bind_data, const vector<column_t> &column_ids,
-                         vector<LogicalType> &file_schema)
+                         optional_ptr<TableFilterSet> filters, vector<LogicalType> &file_schema)
     : file_path(options_p.file_path), file_idx(0), buffer_manager(std::move(buffer_manager_p)),
       state_machine(std::move(state_machine_p)), file_size(buffer_manager->file_handle->FileSize()),
       error_handler(make_shared<CSVErrorHandler>(options_p.ignore_errors)),
@@ -18,7 +18,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> bu
 		options = union_reader.options;
 		types = union_reader.GetTypes();
 		MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-		                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+		                                  bind_data.return_names, column_ids, filters, file_path, context);
 		InitializeFileNamesTypes();
 		return;
 	} else if (!bind_data.column_info.empty()) {
@@ -26,7 +26,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> bu
 		names = bind_data.column_info[0].names;
 		types = bind_data.column_info[0].types;
 		MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-		                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+		                                  bind_data.return_names, column_ids, filters, file_path, context);
 		InitializeFileNamesTypes();
 		return;
 	}
@@ -34,14 +34,14 @@ CSVFileScan::CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> bu
 	types = bind_data.return_types;
 	file_schema = bind_data.return_types;
 	MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-	                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+	                                  bind_data.return_names, column_ids, filters, file_path, context);
 
 	InitializeFileNamesTypes();
 }
 
 CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, const CSVReaderOptions &options_p,
                          const idx_t file_idx_p, const ReadCSVData &bind_data, const vector<column_t> &column_ids,
-                         const vector<LogicalType> &file_schema)
+                         optional_ptr<TableFilterSet> filters, const vector<LogicalType> &file_schema)
     : file_path(file_path_p), file_idx(file_idx_p),
       error_handler(make_shared<CSVErrorHandler>(options_p.ignore_errors)), options(options_p) {
 	if (file_idx < bind_data.union_readers.size()) {
@@ -64,7 +64,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, cons
 			types = union_reader.GetTypes();
 			state_machine = union_reader.state_machine;
 			MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind,
-			                                  bind_data.return_types, bind_data.return_names, column_ids, nullptr,
+			                                  bind_data.return_types, bind_data.return_names, column_ids, filters,
 			                                  file_path, context);
 
 			InitializeFileNamesTypes();
@@ -93,7 +93,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, cons
 		    state_machine_cache.Get(options.dialect_options.state_machine_options), options);
 
 		MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-		                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+		                                  bind_data.return_names, column_ids, filters, file_path, context);
 		InitializeFileNamesTypes();
 		return;
 	}
@@ -124,7 +124,7 @@ CSVFileScan::CSVFileScan(ClientContext &context, const string &file_path_p, cons
 	    make_shared<CSVStateMachine>(state_machine_cache.Get(options.dialect_options.state_machine_options), options);
 
 	MultiFileReader::InitializeReader(*this, options.file_options, bind_data.reader_bind, bind_data.return_types,
-	                                  bind_data.return_names, column_ids, nullptr, file_path, context);
+	                                  bind_data.return_names, column_ids, filters, file_path, context);
 	InitializeFileNamesTypes();
 }
 
@@ -206,6 +206,26 @@ void CSVFileScan::InitializeFileNamesTypes() {
 	file_types = sorted_types;
 }
 
+idx_t CSVFileScan::GetResultIndex(idx_t col_idx) const {
+	if (!projection_ids.empty()) {
+		return reader_data.column_mapping[projection_ids[col_idx].second];
+	}
+	return reader_data.column_mapping[col_idx];
+}
+
+bool CSVFileScan::FilterBeforeCast() const {
+	// if errors are ignored, all rows are cast so that their errors are reported
+	return reader_data.filters && !options.ignore_errors;
+}
+
+bool CSVFileScan::HasFilter(idx_t col_idx) const {
+	if (!reader_data.filters || col_idx >= reader_data.column_ids.size()) {
+		return false;
+	}
+	auto &filters = reader_data.filters->filters;
+	return filters.find(GetResultIndex(col_idx)) != filters.end();
+}
+
 const string &CSVFileScan::GetFileName() {
 	return file_path;
 }
@@ -4,6 +4,9 @@
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
 
 namespace duckdb {
 
@@ -100,7 +103,21 @@ SinkFinalizeType PhysicalVacuum::Finalize(Pipeline &pipeline, Event &event, Clie
 
 SourceResultType PhysicalVacuum::GetData(ExecutionContext &context, DataChunk &chunk,
                                          OperatorSourceInput &input) const {
-	// NOP
+	if (!info->options.vacuum) {
+		// ANALYZE only refreshes the statistics
+		return SourceResultType::FINISHED;
+	}
+	// VACUUM rewrites the row groups with deleted rows and truncates the database file through a checkpoint
+	auto &client = context.client;
+	optional_ptr<AttachedDatabase> db;
+	if (info->table) {
+		db = &info->table->ParentCatalog().GetAttached();
+	} else {
+		db = DatabaseManager::Get(client).GetDatabase(client, DatabaseManager::GetDefaultDatabase(client));
+	}
+	if (db && TransactionManager::Get(*db).IsDuckTransactionManager()) {
+		DuckTransactionManager::Get(*db).Vacuum(client);
+	}
 	return SourceResultType::FINISHED;
 }
 
@@ -0,0 +1,70 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
+
+namespace duckdb {
+
+struct PragmaBufferStatisticsData : public GlobalTableFunctionState {
+	PragmaBufferStatisticsData() : offset(0) {
+	}
+
+	vector<MemoryInformation> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> PragmaBufferStatisticsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                           vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("tag");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("eviction_priority");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("buffer_hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("buffer_misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("hit_ratio");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> PragmaBufferStatisticsInit(ClientContext &context,
+                                                                TableFunctionInitInput &input) {
+	auto result = make_uniq<PragmaBufferStatisticsData>();
+	result->entries = BufferManager::GetBufferManager(context).GetMemoryUsageInfo();
+	return std::move(result);
+}
+
+void PragmaBufferStatisticsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<PragmaBufferStatisticsData>();
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		idx_t col = 0;
+		// tag, VARCHAR
+		output.SetValue(col++, count, EnumUtil::ToString(entry.tag));
+		// eviction_priority, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(BufferPool::GetEvictionPriority(entry.tag))));
+		// buffer_hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.buffer_hits)));
+		// buffer_misses, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.buffer_misses)));
+		// hit_ratio, DOUBLE
+		auto accesses = entry.buffer_hits + entry.buffer_misses;
+		output.SetValue(col++, count,
+		                accesses == 0 ? Value() : Value::DOUBLE(double(entry.buffer_hits) / double(accesses)));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void PragmaBufferStatistics::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("pragma_buffer_statistics", {}, PragmaBufferStatisticsFunction,
+	                              PragmaBufferStatisticsBind, PragmaBufferStatisticsInit));
+}
+
+} // namespace duckdb
@@ -31,6 +31,7 @@ struct SetDefaultInfo;
 struct ChangeColumnTypeInfo;
 struct AlterForeignKeyInfo;
 struct SetNotNullInfo;
+struct SetClusterByInfo;
 struct DropNotNullInfo;
 struct SetColumnCommentInfo;
 
@@ -79,6 +80,8 @@ public:
 
 	//! Returns a list of the constraints of the table
 	DUCKDB_API const vector<unique_ptr<Constraint>> &GetConstraints();
+	//! Returns the columns the table is clustered on during checkpoints (empty if the table has no cluster key)
+	DUCKDB_API const vector<string> &GetClusterBy() const;
 	DUCKDB_API string ToSQL() const override;
 
 	//! Get statistics of a column (physical or virtual) within the table
@@ -98,6 +101,8 @@ public:
 	}
 
 	DUCKDB_API static string ColumnsToSQL(const ColumnList &columns, const vector<unique_ptr<Constraint>> &constraints);
+	//! Verifies that a cluster key only refers to existing, non-generated columns and normalizes the column names
+	DUCKDB_API static void BindClusterBy(const ColumnList &columns, vector<string> &cluster_by);
 
 	//! Returns a list of segment information for this table, if exists
 	virtual vector<ColumnSegmentInfo> GetColumnSegmentInfo();
@@ -113,5 +118,7 @@ protected:
 	ColumnList columns;
 	//! A list of constraints that are part of this table
 	vector<unique_ptr<Constraint>> constraints;
+	//! The columns the table is clustered on during checkpoints
+	vector<string> cluster_by;
 };
 } // namespace duckdb
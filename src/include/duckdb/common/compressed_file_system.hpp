@@ -13,6 +13,7 @@
 
 namespace duckdb {
 class CompressedFile;
+class CompressedFileReadAhead;
 
 struct StreamData {
 	// various buffers & pointers
@@ -39,6 +40,14 @@ struct StreamWrapper {
 	DUCKDB_API virtual void Close() = 0;
 };
 
+//! A frame of a compressed file that can be decompressed independently of the rest of the file
+struct CompressedFrame {
+	//! The offset of the frame in the compressed file
+	idx_t offset;
+	//! The compressed size of the frame
+	idx_t size;
+};
+
 class CompressedFileSystem : public FileSystem {
 public:
 	DUCKDB_API int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
@@ -54,6 +63,13 @@ public:
 	DUCKDB_API virtual unique_ptr<StreamWrapper> CreateStream() = 0;
 	DUCKDB_API virtual idx_t InBufferSize() = 0;
 	DUCKDB_API virtual idx_t OutBufferSize() = 0;
+
+	//! Finds the frames of a compressed file without decompressing it, returns false if the file does not consist of
+	//! frames that can be found this way. The frames are decompressed in parallel when the file is read ahead.
+	DUCKDB_API virtual bool GetFrames(FileHandle &handle, vector<CompressedFrame> &frames);
+	//! Decompresses a single frame into the output buffer, which is grown if required, returns the decompressed size
+	DUCKDB_API virtual idx_t DecompressFrame(const_data_ptr_t input, idx_t input_size,
+	                                         unsafe_unique_array<data_t> &output, idx_t &output_capacity);
 };
 
 class CompressedFile : public FileHandle {
@@ -72,9 +88,20 @@ public:
 	DUCKDB_API int64_t ReadData(void *buffer, int64_t nr_bytes);
 	DUCKDB_API int64_t WriteData(data_ptr_t buffer, int64_t nr_bytes);
 	DUCKDB_API void Close() override;
+	//! Decompresses the file ahead of the reader on background threads. The frames of the file are decompressed in
+	//! parallel if the file system can find them, otherwise a single thread decompresses the stream ahead of the reader.
+	DUCKDB_API void StartReadAhead(idx_t thread_count);
+
+private:
+	friend class CompressedFileReadAhead;
+	//! Reads data by decompressing the stream
+	int64_t ReadStream(void *buffer, int64_t nr_bytes);
 
 private:
 	unique_ptr<StreamWrapper> stream_wrapper;
+	//! The number of threads to read ahead with (0 if the file is not read ahead)
+	idx_t read_ahead_threads = 0;
+	unique_ptr<CompressedFileReadAhead> read_ahead;
 };
 
 } // namespace duckdb
@@ -0,0 +1,22 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_replacement_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+enum class BufferReplacementPolicy : uint8_t {
+	//! Evict the least recently used blocks first
+	LRU = 0,
+	//! Scan-resistant 2Q: blocks that were only used once are evicted before blocks that were used again
+	TWO_QUEUE = 1
+};
+
+} // namespace duckdb
@@ -31,6 +31,10 @@ public:
 	unique_ptr<StreamWrapper> CreateStream() override;
 	idx_t InBufferSize() override;
 	idx_t OutBufferSize() override;
+
+	bool GetFrames(FileHandle &handle, vector<CompressedFrame> &frames) override;
+	idx_t DecompressFrame(const_data_ptr_t input, idx_t input_size, unsafe_unique_array<data_t> &output,
+	                      idx_t &output_capacity) override;
 };
 
 static constexpr const uint8_t GZIP_COMPRESSION_DEFLATE = 0x08;
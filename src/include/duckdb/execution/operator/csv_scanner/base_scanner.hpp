@@ -12,6 +12,7 @@
 #include "duckdb/execution/operator/csv_scanner/scanner_boundary.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_state_machine.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_error.hpp"
+#include "duckdb/execution/operator/csv_scanner/csv_structural_index.hpp"
 #include "duckdb/common/helper.hpp"
 
 namespace duckdb {
@@ -115,10 +116,6 @@ protected:
 	//! Initializes the scanner
 	virtual void Initialize();
 
-	inline bool ContainsZeroByte(uint64_t v) {
-		return (v - UINT64_C(0x0101010101010101)) & ~(v)&UINT64_C(0x8080808080808080);
-	}
-
 	//! Process one chunk
 	template <class T>
 	void Process(T &result) {
@@ -132,6 +129,8 @@ protected:
 		} else {
 			to_pos = cur_buffer_handle->actual_size;
 		}
+		CSVStructuralIndex structural_index(state_machine->transition_array, buffer_handle_ptr,
+		                                    cur_buffer_handle->actual_size);
 		while (iterator.pos.buffer_pos < to_pos) {
 			state_machine->Transition(states, buffer_handle_ptr[iterator.pos.buffer_pos]);
 			switch (states.states[1]) {
@@ -191,20 +190,10 @@ protected:
 				ever_quoted = true;
 				T::SetQuoted(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.quote) &
-					                     (value ^ state_machine->transition_array.escape))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
-
-				while (state_machine->transition_array
-				           .skip_quoted[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
-				       iterator.pos.buffer_pos < to_pos - 1) {
-					iterator.pos.buffer_pos++;
+				// skip to the next quote, escape or newline, the last character is always left to the state machine
+				if (iterator.pos.buffer_pos + 1 < to_pos) {
+					iterator.pos.buffer_pos =
+					    MinValue<idx_t>(structural_index.NextQuoted(iterator.pos.buffer_pos, to_pos), to_pos - 1);
 				}
 			} break;
 			case CSVState::ESCAPE:
@@ -213,20 +202,10 @@ protected:
 				break;
 			case CSVState::STANDARD: {
 				iterator.pos.buffer_pos++;
-				while (iterator.pos.buffer_pos + 8 < to_pos) {
-					uint64_t value =
-					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
-					if (ContainsZeroByte((value ^ state_machine->transition_array.delimiter) &
-					                     (value ^ state_machine->transition_array.new_line) &
-					                     (value ^ state_machine->transition_array.carriage_return))) {
-						break;
-					}
-					iterator.pos.buffer_pos += 8;
-				}
-				while (state_machine->transition_array
-				           .skip_standard[static_cast<uint8_t>(buffer_handle_ptr[iterator.pos.buffer_pos])] &&
-				       iterator.pos.buffer_pos < to_pos - 1) {
-					iterator.pos.buffer_pos++;
+				// skip to the next delimiter or newline, the last character is always left to the state machine
+				if (iterator.pos.buffer_pos + 1 < to_pos) {
+					iterator.pos.buffer_pos =
+					    MinValue<idx_t>(structural_index.NextStandard(iterator.pos.buffer_pos, to_pos), to_pos - 1);
 				}
 				break;
 			}
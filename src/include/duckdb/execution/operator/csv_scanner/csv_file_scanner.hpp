@@ -22,11 +22,12 @@ public:
 	//! This means the options are alreadu set, and the buffer manager is already up and runinng.
 	CSVFileScan(ClientContext &context, shared_ptr<CSVBufferManager> buffer_manager,
 	            shared_ptr<CSVStateMachine> state_machine, const CSVReaderOptions &options,
-	            const ReadCSVData &bind_data, const vector<column_t> &column_ids, vector<LogicalType> &file_schema);
+	            const ReadCSVData &bind_data, const vector<column_t> &column_ids, optional_ptr<TableFilterSet> filters,
+	            vector<LogicalType> &file_schema);
 	//! Constructor for new CSV Files, we must initialize the buffer manager and the state machine
 	//! Path to this file
 	CSVFileScan(ClientContext &context, const string &file_path, const CSVReaderOptions &options, const idx_t file_idx,
-	            const ReadCSVData &bind_data, const vector<column_t> &column_ids,
+	            const ReadCSVData &bind_data, const vector<column_t> &column_ids, optional_ptr<TableFilterSet> filters,
 	            const vector<LogicalType> &file_schema);
 
 	CSVFileScan(ClientContext &context, const string &file_name, CSVReaderOptions &options);
@@ -38,6 +39,13 @@ public:
 
 	//! Initialize the actual names and types to be scanned from the file
 	void InitializeFileNamesTypes();
+	//! Returns the index in the result chunk of a column of the parsed chunk
+	idx_t GetResultIndex(idx_t col_idx) const;
+	//! Whether the rows are filtered before the columns without filters are cast, in which case these columns are
+	//! parsed as VARCHAR and only the rows that pass the filters are cast
+	bool FilterBeforeCast() const;
+	//! Whether a pushed down filter is evaluated on a column of the parsed chunk
+	bool HasFilter(idx_t col_idx) const;
 	const string file_path;
 	//! File Index
 	idx_t file_idx;
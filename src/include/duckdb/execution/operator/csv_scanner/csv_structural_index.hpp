@@ -0,0 +1,128 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/csv_scanner/csv_structural_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/bit_utils.hpp"
+#include "duckdb/common/typedefs.hpp"
+#include "duckdb/common/types.hpp"
+#include "duckdb/execution/operator/csv_scanner/csv_state_machine_cache.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DUCKDB_CSV_STRUCTURAL_INDEX_SSE2
+#endif
+
+namespace duckdb {
+
+//! The CSVStructuralIndex finds the characters that can end a run of bytes the scanner may skip, i.e., delimiters and
+//! newlines for values in the standard state, and quotes, escapes and newlines for values in the quoted state.
+//! It classifies blocks of 64 bytes at once into one bitmask per state, so that the next such character can be found
+//! with a count trailing zeros, and the bitmasks of a block are reused for all values that start in it.
+class CSVStructuralIndex {
+public:
+	static constexpr idx_t BLOCK_SIZE = 64;
+
+	CSVStructuralIndex(const StateMachine &transition_array_p, const char *buffer_p, idx_t buffer_size_p)
+	    : transition_array(transition_array_p), buffer(buffer_p), buffer_size(buffer_size_p) {
+	}
+
+	//! Returns the position of the first character in [pos, end) that the standard state cannot skip, or end
+	inline idx_t NextStandard(idx_t pos, idx_t end) {
+		return Next<false>(pos, end);
+	}
+	//! Returns the position of the first character in [pos, end) that the quoted state cannot skip, or end
+	inline idx_t NextQuoted(idx_t pos, idx_t end) {
+		return Next<true>(pos, end);
+	}
+
+private:
+	template <bool QUOTED>
+	idx_t Next(idx_t pos, idx_t end) {
+		while (pos < end) {
+			if (pos < block_start || pos >= block_end) {
+				if (pos + BLOCK_SIZE > buffer_size) {
+					// the remainder of the buffer is smaller than a block: look at one byte at a time
+					auto &skip = QUOTED ? transition_array.skip_quoted : transition_array.skip_standard;
+					while (pos < end && skip[static_cast<uint8_t>(buffer[pos])]) {
+						pos++;
+					}
+					return pos;
+				}
+				IndexBlock(pos);
+			}
+			auto mask = (QUOTED ? quoted_mask : standard_mask) >> (pos - block_start);
+			if (mask) {
+				return MinValue<idx_t>(pos + static_cast<idx_t>(CountZeros<uint64_t>::Trailing(mask)), end);
+			}
+			pos = block_end;
+		}
+		return end;
+	}
+
+	void IndexBlock(idx_t pos) {
+		block_start = pos;
+		block_end = pos + BLOCK_SIZE;
+		standard_mask = 0;
+		quoted_mask = 0;
+		auto block = buffer + pos;
+#ifdef DUCKDB_CSV_STRUCTURAL_INDEX_SSE2
+		const auto delimiter = _mm_set1_epi8(static_cast<char>(transition_array.delimiter));
+		const auto quote = _mm_set1_epi8(static_cast<char>(transition_array.quote));
+		const auto escape = _mm_set1_epi8(static_cast<char>(transition_array.escape));
+		const auto new_line = _mm_set1_epi8('\n');
+		const auto carriage_return = _mm_set1_epi8('\r');
+		for (idx_t i = 0; i < BLOCK_SIZE; i += 16) {
+			auto chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + i));
+			auto line_end = _mm_or_si128(_mm_cmpeq_epi8(chars, new_line), _mm_cmpeq_epi8(chars, carriage_return));
+			auto standard = _mm_or_si128(line_end, _mm_cmpeq_epi8(chars, delimiter));
+			auto quoted =
+			    _mm_or_si128(line_end, _mm_or_si128(_mm_cmpeq_epi8(chars, quote), _mm_cmpeq_epi8(chars, escape)));
+			standard_mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(standard))) << i;
+			quoted_mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(quoted))) << i;
+		}
+#else
+		for (idx_t i = 0; i < BLOCK_SIZE; i += sizeof(uint64_t)) {
+			auto chars = Load<uint64_t>(const_data_ptr_cast(block + i));
+			auto line_end = MatchBytes(chars, transition_array.new_line) |
+			                MatchBytes(chars, transition_array.carriage_return);
+			auto standard = line_end | MatchBytes(chars, transition_array.delimiter);
+			auto quoted =
+			    line_end | MatchBytes(chars, transition_array.quote) | MatchBytes(chars, transition_array.escape);
+			standard_mask |= CompressHighBits(standard) << i;
+			quoted_mask |= CompressHighBits(quoted) << i;
+		}
+#endif
+	}
+
+#ifndef DUCKDB_CSV_STRUCTURAL_INDEX_SSE2
+	//! Sets the high bit of every byte of chars that equals the byte replicated in pattern
+	static inline uint64_t MatchBytes(uint64_t chars, uint64_t pattern) {
+		auto x = chars ^ pattern;
+		auto non_zero = ((x & UINT64_C(0x7F7F7F7F7F7F7F7F)) + UINT64_C(0x7F7F7F7F7F7F7F7F)) | x;
+		return ~non_zero & UINT64_C(0x8080808080808080);
+	}
+	//! Gathers the high bits of the eight bytes into the lowest eight bits
+	static inline uint64_t CompressHighBits(uint64_t high_bits) {
+		return ((high_bits >> 7) * UINT64_C(0x0102040810204080)) >> 56;
+	}
+#endif
+
+private:
+	const StateMachine &transition_array;
+	const char *buffer;
+	idx_t buffer_size;
+	//! The indexed block [block_start, block_end), which is empty until the first block is indexed
+	idx_t block_start = 0;
+	idx_t block_end = 0;
+	//! The bitmasks of the characters of the block that the standard and the quoted state cannot skip
+	uint64_t standard_mask = 0;
+	uint64_t quoted_mask = 0;
+};
+
+} // namespace duckdb
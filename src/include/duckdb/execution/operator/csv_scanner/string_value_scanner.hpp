@@ -187,6 +187,12 @@ private:
 
 	void SetStart();
 
+	//! Casts a column of the parsed chunk to its type in the insert chunk, only casting the rows in row_sel if set
+	void CastColumn(idx_t col_idx, DataChunk &parse_chunk, DataChunk &insert_chunk,
+	                optional_ptr<SelectionVector> row_sel, unordered_set<idx_t> &borked_lines);
+	//! Applies the filters pushed into the scan to the insert chunk, returns the number of rows that pass them
+	idx_t ApplyFilters(DataChunk &insert_chunk, SelectionVector &sel);
+
 	StringValueResult result;
 	vector<LogicalType> types;
 
@@ -12,6 +12,7 @@
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
+#include "duckdb/common/enums/buffer_replacement_policy.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
 #include "duckdb/common/enums/optimizer_type.hpp"
 #include "duckdb/common/enums/order_type.hpp"
@@ -29,6 +30,7 @@
 #include "duckdb/parser/parser_extension.hpp"
 #include "duckdb/planner/operator_extension.hpp"
 #include "duckdb/storage/compression/bitpacking.hpp"
+#include "duckdb/storage/statistics/json_path_statistics.hpp"
 #include "duckdb/main/client_properties.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
 
@@ -120,6 +122,8 @@ struct DBConfigOptions {
 	string autoinstall_extension_repo = "";
 	//! The maximum memory used by the database system (in bytes). Default: 80% of System available memory
 	idx_t maximum_memory = (idx_t)-1;
+	//! The replacement policy used to decide which blocks to evict from the buffer pool
+	BufferReplacementPolicy buffer_replacement_policy = BufferReplacementPolicy::LRU;
 	//! The maximum amount of CPU threads used by the database system. Default: all available.
 	idx_t maximum_threads = (idx_t)-1;
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
@@ -132,6 +136,9 @@ struct DBConfigOptions {
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
+	//! The fraction of deleted rows above which a checkpoint rewrites a row group to reclaim the space of the deleted
+	//! rows
+	double vacuum_delete_threshold = 0.5;
 	//! Whether or not to allow printing unredacted secrets
 	bool allow_unredacted_secrets = false;
 	//! The collation type of the database
@@ -242,6 +249,8 @@ public:
 	shared_ptr<BufferManager> buffer_manager;
 	//! Set of callbacks that can be installed by extensions
 	vector<unique_ptr<ExtensionCallback>> extension_callbacks;
+	//! Computes the statistics of the paths within JSON columns at checkpoint (installed by the JSON extension)
+	json_path_statistics_analyzer_t json_path_statistics_analyzer = nullptr;
 
 public:
 	DUCKDB_API static DBConfig &GetConfig(ClientContext &context);
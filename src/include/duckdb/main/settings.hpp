@@ -72,6 +72,17 @@ struct CheckpointThresholdSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct VacuumDeleteThresholdSetting {
+	static constexpr const char *Name = "vacuum_delete_threshold";
+	static constexpr const char *Description =
+	    "The fraction of deleted rows (between 0 and 1) above which a checkpoint rewrites a row group to reclaim the "
+	    "space of the deleted rows";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::DOUBLE;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct DebugCheckpointAbort {
 	static constexpr const char *Name = "debug_checkpoint_abort";
 	static constexpr const char *Description =
@@ -453,6 +464,16 @@ struct MaximumExpressionDepthSetting {
 	static Value GetSetting(ClientContext &context);
 };
 
+struct BufferReplacementPolicySetting {
+	static constexpr const char *Name = "buffer_replacement_policy";
+	static constexpr const char *Description =
+	    "The policy used to pick blocks to evict from the buffer pool: lru, or the scan-resistant 2q";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(ClientContext &context);
+};
+
 struct MaximumMemorySetting {
 	static constexpr const char *Name = "max_memory";
 	static constexpr const char *Description = "The maximum memory of the system (e.g. 1GB)";
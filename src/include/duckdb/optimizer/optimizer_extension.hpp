@@ -24,9 +24,10 @@ typedef void (*optimize_function_t)(ClientContext &context, OptimizerExtensionIn
 
 class OptimizerExtension {
 public:
-	//! The parse function of the parser extension.
-	//! Takes a query string as input and returns ParserExtensionParseData (on success) or an error
-	optimize_function_t optimize_function;
+	//! The optimize function of the optimizer extension, which runs after the built-in optimizers
+	optimize_function_t optimize_function = nullptr;
+	//! The pre-optimize function of the optimizer extension, which runs before the built-in optimizers
+	optimize_function_t pre_optimize_function = nullptr;
 
 	//! Additional parser info passed to the parse function
 	shared_ptr<OptimizerExtensionInfo> optimizer_info;
@@ -71,7 +71,8 @@ enum class AlterTableType : uint8_t {
 	FOREIGN_KEY_CONSTRAINT = 7,
 	SET_NOT_NULL = 8,
 	DROP_NOT_NULL = 9,
-	SET_COLUMN_COMMENT = 10
+	SET_COLUMN_COMMENT = 10,
+	SET_CLUSTER_BY = 11
 };
 
 struct AlterTableInfo : public AlterInfo {
@@ -290,6 +291,25 @@ private:
 	DropNotNullInfo();
 };
 
+//===--------------------------------------------------------------------===//
+// SetClusterByInfo
+//===--------------------------------------------------------------------===//
+struct SetClusterByInfo : public AlterTableInfo {
+	SetClusterByInfo(AlterEntryData data, vector<string> cluster_by);
+	~SetClusterByInfo() override;
+
+	//! The new cluster key of the table (an empty key removes the cluster key)
+	vector<string> cluster_by;
+
+public:
+	unique_ptr<AlterInfo> Copy() const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<AlterTableInfo> Deserialize(Deserializer &deserializer);
+
+private:
+	SetClusterByInfo();
+};
+
 //===--------------------------------------------------------------------===//
 // Alter View
 //===--------------------------------------------------------------------===//
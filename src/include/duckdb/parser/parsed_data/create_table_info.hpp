@@ -15,6 +15,7 @@
 #include "duckdb/parser/statement/select_statement.hpp"
 #include "duckdb/catalog/catalog_entry/column_dependency_manager.hpp"
 #include "duckdb/parser/column_list.hpp"
+#include "duckdb/storage/storage_info.hpp"
 
 namespace duckdb {
 class SchemaCatalogEntry;
@@ -32,6 +33,10 @@ struct CreateTableInfo : public CreateInfo {
 	vector<unique_ptr<Constraint>> constraints;
 	//! CREATE TABLE as QUERY
 	unique_ptr<SelectStatement> query;
+	//! The maximum number of rows per row group of the table
+	idx_t row_group_size = Storage::ROW_GROUP_SIZE;
+	//! The columns the table is clustered on at checkpoint time (if any)
+	vector<string> cluster_by;
 
 public:
 	DUCKDB_API unique_ptr<CreateInfo> Copy() const override;
@@ -32,6 +32,7 @@ namespace duckdb {
 class ColumnDefinition;
 struct OrderByNode;
 struct CopyInfo;
+struct CreateTableInfo;
 struct CommonTableExpressionInfo;
 struct GroupingExpressionMap;
 class OnConflictInfo;
@@ -280,6 +281,12 @@ private:
 	string TransformCollation(optional_ptr<duckdb_libpgquery::PGCollateClause> collate);
 
 	ColumnDefinition TransformColumnDefinition(duckdb_libpgquery::PGColumnDef &cdef);
+	//! Transform the WITH (...) storage options of a CREATE TABLE statement
+	void TransformTableOptions(duckdb_libpgquery::PGList *options, CreateTableInfo &info);
+	//! Transform the constant argument of a table storage option
+	Value TransformTableOptionValue(duckdb_libpgquery::PGDefElem &def_elem);
+	//! Transform the cluster_by table option (a comma-separated list of column names)
+	vector<string> TransformClusterBy(const Value &value);
 	//===--------------------------------------------------------------------===//
 	// Helpers
 	//===--------------------------------------------------------------------===//
@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/json_path_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/statistics/json_path_statistics.hpp"
+
+namespace duckdb {
+
+//! The JSONPathFilter is a filter on the value at a path within the JSON objects of a column, e.g., for
+//! WHERE j->>'$.user.id' = '42'. It is only checked against the JSONPathStatistics of the row groups to skip them: the
+//! scan does not evaluate it, so the filter expression it was derived from has to stay in the plan.
+class JSONPathFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::JSON_PATH;
+
+public:
+	JSONPathFilter(vector<string> path, unique_ptr<TableFilter> child_filter);
+
+	//! The object keys that make up the path
+	vector<string> path;
+	//! The filter on the extracted value (a constant comparison)
+	unique_ptr<TableFilter> child_filter;
+
+public:
+	//! The column statistics do not contain the paths, so these never prune
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	//! Checks the filter against the path statistics of a row group
+	FilterPropagateResult CheckPathStatistics(vector<JSONPathStatistics> &path_statistics);
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+
+	//! Checks the JSONPathFilters within a (conjunction) filter against the path statistics of a row group
+	static FilterPropagateResult CheckPathStatistics(TableFilter &filter,
+	                                                 vector<JSONPathStatistics> &path_statistics);
+};
+
+} // namespace duckdb
@@ -105,6 +105,9 @@ public:
 
 private:
 	static BufferHandle Load(shared_ptr<BlockHandle> &handle, unique_ptr<FileBuffer> buffer = nullptr);
+	//! Load the block from a buffer that already holds its on-disk contents (e.g. filled by a batched read)
+	static BufferHandle LoadFromBuffer(shared_ptr<BlockHandle> &handle, data_ptr_t data,
+	                                   unique_ptr<FileBuffer> reusable_buffer);
 	unique_ptr<FileBuffer> UnloadAndTakeBlock();
 	void Unload();
 	bool CanUnload();
@@ -123,6 +126,10 @@ private:
 	unique_ptr<FileBuffer> buffer;
 	//! Internal eviction timestamp
 	atomic<idx_t> eviction_timestamp;
+	//! The eviction queue holding the latest eviction node of this block
+	idx_t eviction_queue_idx;
+	//! The number of times the block was pinned since it was loaded (saturates at 2)
+	uint8_t access_count;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
 	bool can_destroy;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
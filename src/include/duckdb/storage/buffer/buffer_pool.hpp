@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/enums/buffer_replacement_policy.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
@@ -34,6 +35,11 @@ struct BufferEvictionNode {
 
 //! The BufferPool is in charge of handling memory management for one or more databases. It defines memory limits
 //! and implements priority eviction among all users of the pool.
+//! Unpinned blocks are kept in a set of eviction queues. Blocks of memory tags with a higher eviction priority (index
+//! and metadata blocks) are only evicted once the queues of the lower priority are empty. With the 2Q replacement
+//! policy every priority additionally has a probationary queue for blocks that have only been used once since they
+//! were loaded, which is drained before the queue of blocks that were used again - so a single large scan does not
+//! evict the working set.
 class BufferPool {
 	friend class BlockHandle;
 	friend class BlockManager;
@@ -58,6 +64,12 @@ public:
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
+	void SetReplacementPolicy(BufferReplacementPolicy policy);
+	BufferReplacementPolicy GetReplacementPolicy() const;
+
+	//! The eviction priority of blocks with the given tag: blocks with a lower priority are evicted first
+	static idx_t GetEvictionPriority(MemoryTag tag);
+
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -73,23 +85,20 @@ protected:
 	                                   unique_ptr<FileBuffer> *buffer = nullptr);
 
 	//! Tries to dequeue an element from the eviction queue, but only after acquiring the purge queue lock.
-	bool TryDequeueWithLock(BufferEvictionNode &node);
+	bool TryDequeueWithLock(EvictionQueue &queue, BufferEvictionNode &node);
 	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
-	void PurgeIteration(const idx_t purge_size);
-	//! Garbage collect dead nodes in the eviction queue.
+	void PurgeIteration(EvictionQueue &queue, const idx_t purge_size);
+	//! Garbage collect dead nodes in the eviction queues.
 	void PurgeQueue();
+	//! Garbage collect dead nodes in a single eviction queue.
+	void PurgeQueue(EvictionQueue &queue);
 	//! Add a buffer handle to the eviction queue. Returns true, if the queue is
 	//! ready to be purged, and false otherwise.
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
-
-	//! Increment the dead node counter in the purge queue.
-	inline void IncrementDeadNodes() {
-		total_dead_nodes++;
-	}
-	//! Decrement the dead node counter in the purge queue.
-	inline void DecrementDeadNodes() {
-		total_dead_nodes--;
-	}
+	//! Returns the index of the eviction queue the (unpinned) block belongs in
+	idx_t GetEvictionQueueIndex(BlockHandle &handle) const;
+	//! Increment the dead node counter of the queue holding the latest eviction node of the block.
+	void IncrementDeadNodes(BlockHandle &handle);
 
 protected:
 	//! The lock for changing the memory limit
@@ -98,8 +107,10 @@ protected:
 	atomic<idx_t> current_memory;
 	//! The maximum amount of memory that the buffer manager can keep (in bytes)
 	atomic<idx_t> maximum_memory;
-	//! Eviction queue
-	unique_ptr<EvictionQueue> queue;
+	//! Eviction queues, in the order in which blocks are evicted from them
+	vector<unique_ptr<EvictionQueue>> queues;
+	//! The replacement policy used to decide which queue an unpinned block is added to
+	atomic<BufferReplacementPolicy> replacement_policy;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
 	//! Memory usage per tag
@@ -116,17 +127,13 @@ protected:
 	//! exceed their allowed ratio. Must be greater than 1.
 	constexpr static idx_t ALIVE_NODE_MULTIPLIER = 4;
 
-	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
+	//! The number of eviction priorities
+	constexpr static idx_t EVICTION_PRIORITY_COUNT = 2;
+	//! The number of eviction queues: a probationary and a protected queue per eviction priority
+	constexpr static idx_t EVICTION_QUEUE_COUNT = EVICTION_PRIORITY_COUNT * 2;
+
+	//! Total number of insertions into the eviction queues. This guides the schedule for calling PurgeQueue.
 	atomic<idx_t> evict_queue_insertions;
-	//! Total dead nodes in the eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
-	//! handle, or (2) we insert a newer version into the eviction queue.
-	atomic<idx_t> total_dead_nodes;
-	//! Locked, if a queue purge is currently active or we're trying to forcefully evict a node.
-	//! Only lets a single thread enter the purge phase.
-	mutex purge_lock;
-
-	//! A pre-allocated vector of eviction nodes. We reuse this to keep the allocation overhead of purges small.
-	vector<BufferEvictionNode> purge_nodes;
 };
 
 } // namespace duckdb
@@ -40,6 +40,8 @@ public:
 	virtual void ReAllocate(shared_ptr<BlockHandle> &handle, idx_t block_size) = 0;
 	virtual BufferHandle Pin(shared_ptr<BlockHandle> &handle) = 0;
 	virtual void Unpin(shared_ptr<BlockHandle> &handle) = 0;
+	//! Load the given blocks into memory ahead of them being pinned, coalescing reads of adjacent blocks
+	virtual void Prefetch(vector<shared_ptr<BlockHandle>> &handles);
 	//! Returns the currently allocated memory
 	virtual idx_t GetUsedMemory() const = 0;
 	//! Returns the maximum available memory
@@ -30,6 +30,12 @@ public:
 	void WriteTableData(Serializer &metadata_serializer);
 
 	CompressionType GetColumnCompressionType(idx_t i);
+	//! Returns the physical columns the table is clustered on
+	vector<PhysicalIndex> GetClusterColumns();
+	//! The fraction of deleted rows above which a row group is rewritten during the checkpoint
+	virtual double GetVacuumDeleteThreshold();
+	//! Row groups that store data at or after this block are rewritten (INVALID_BLOCK if none)
+	virtual block_id_t GetCompactionBlock();
 
 	virtual void FinalizeTable(const TableStatistics &global_stats, DataTableInfo *info, Serializer &serializer) = 0;
 	virtual unique_ptr<RowGroupWriter> GetRowGroupWriter(RowGroup &row_group) = 0;
@@ -52,6 +58,8 @@ public:
 public:
 	void FinalizeTable(const TableStatistics &global_stats, DataTableInfo *info, Serializer &serializer) override;
 	unique_ptr<RowGroupWriter> GetRowGroupWriter(RowGroup &row_group) override;
+	double GetVacuumDeleteThreshold() override;
+	block_id_t GetCompactionBlock() override;
 
 private:
 	SingleFileCheckpointWriter &checkpoint_manager;
@@ -96,7 +96,7 @@ class SingleFileCheckpointWriter final : public CheckpointWriter {
 	friend class SingleFileTableDataWriter;
 
 public:
-	SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager);
+	SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager, bool vacuum = false);
 
 	//! Checkpoint the current state of the WAL and flush it to the main storage. This should be called BEFORE any
 	//! connection is available because right now the checkpointing cannot be done online. (TODO)
@@ -108,7 +108,19 @@ public:
 
 	BlockManager &GetBlockManager();
 
+	//! The fraction of deleted rows above which row groups are rewritten
+	double GetVacuumDeleteThreshold() const;
+	//! Row groups that store data in blocks at or after this block are rewritten so the file can be truncated
+	//! (INVALID_BLOCK if the checkpoint does not compact the file)
+	block_id_t GetCompactionBlock() const {
+		return compaction_block;
+	}
+
 private:
+	//! Whether or not this checkpoint was triggered by VACUUM
+	bool vacuum;
+	//! The first block that is moved towards the front of the file during a VACUUM checkpoint
+	block_id_t compaction_block;
 	//! The metadata writer is responsible for writing schema information
 	unique_ptr<MetadataWriter> metadata_writer;
 	//! The table data writer is responsible for writing the DataPointers used by the table chunks
@@ -49,7 +49,7 @@ public:
 	//! Constructs a new data table from an (optional) set of persistent segments
 	DataTable(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager, const string &schema,
 	          const string &table, vector<ColumnDefinition> column_definitions_p,
-	          unique_ptr<PersistentTableData> data = nullptr);
+	          unique_ptr<PersistentTableData> data = nullptr, idx_t row_group_size = Storage::ROW_GROUP_SIZE);
 	//! Constructs a DataTable as a delta on an existing data table with a newly added column
 	DataTable(ClientContext &context, DataTable &parent, ColumnDefinition &new_column, Expression &default_value);
 	//! Constructs a DataTable as a delta on an existing data table but with one column removed
@@ -176,6 +176,8 @@ public:
 	void CommitDropColumn(idx_t index);
 
 	idx_t GetTotalRows();
+	//! The maximum number of rows per row group of the table
+	idx_t GetRowGroupSize() const;
 
 	vector<ColumnSegmentInfo> GetColumnSegmentInfo();
 	static bool IsForeignKeyIndex(const vector<PhysicalIndex> &fk_keys, Index &index, ForeignKeyType fk_type);
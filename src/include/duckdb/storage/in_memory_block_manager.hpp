@@ -47,6 +47,9 @@ public:
 	void Read(Block &block) override {
 		throw InternalException("Cannot perform IO in in-memory database - Read!");
 	}
+	void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) override {
+		throw InternalException("Cannot perform IO in in-memory database - ReadBlocks!");
+	}
 	void Write(FileBuffer &block, block_id_t block_id) override {
 		throw InternalException("Cannot perform IO in in-memory database - Write!");
 	}
@@ -9,6 +9,9 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/list.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/string.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -24,17 +27,19 @@ public:
 	}
 
 	virtual string GetObjectType() = 0;
+
+	//! The estimated memory usage of the entry. Entries without an estimate do not count towards the memory limit
+	//! of the cache and are never evicted.
+	virtual optional_idx GetEstimatedCacheMemory() const {
+		return optional_idx();
+	}
 };
 
 class ObjectCache {
 public:
 	shared_ptr<ObjectCacheEntry> GetObject(const string &key) {
 		lock_guard<mutex> glock(lock);
-		auto entry = cache.find(key);
-		if (entry == cache.end()) {
-			return nullptr;
-		}
-		return entry->second;
+		return GetObjectInternal(key);
 	}
 
 	template <class T>
@@ -50,35 +55,56 @@ public:
 	shared_ptr<T> GetOrCreate(const string &key, ARGS &&... args) {
 		lock_guard<mutex> glock(lock);
 
-		auto entry = cache.find(key);
-		if (entry == cache.end()) {
+		auto object = GetObjectInternal(key);
+		if (!object) {
 			auto value = make_shared<T>(args...);
-			cache[key] = value;
+			PutInternal(key, value);
 			return value;
 		}
-		auto object = entry->second;
-		if (!object || object->GetObjectType() != T::ObjectType()) {
+		if (object->GetObjectType() != T::ObjectType()) {
 			return nullptr;
 		}
 		return std::static_pointer_cast<T, ObjectCacheEntry>(object);
 	}
 
-	void Put(string key, shared_ptr<ObjectCacheEntry> value) {
-		lock_guard<mutex> glock(lock);
-		cache.insert(make_pair(std::move(key), std::move(value)));
-	}
+	//! Adds the entry to the cache, replacing the entry with the same key (if any)
+	DUCKDB_API void Put(string key, shared_ptr<ObjectCacheEntry> value);
+	DUCKDB_API void Delete(const string &key);
 
-	void Delete(const string &key) {
-		lock_guard<mutex> glock(lock);
-		cache.erase(key);
-	}
+	//! Sets the maximum memory usage of the entries that have an estimated memory usage, evicting the least recently
+	//! used entries if the cache exceeds it
+	DUCKDB_API void SetMaxMemory(idx_t max_memory);
+	DUCKDB_API idx_t GetMaxMemory();
+	//! The summed estimated memory usage of the entries in the cache
+	DUCKDB_API idx_t GetMemoryUsage();
 
 	DUCKDB_API static ObjectCache &GetObjectCache(ClientContext &context);
 	DUCKDB_API static bool ObjectCacheEnabled(ClientContext &context);
 
+private:
+	struct ObjectCacheValue {
+		shared_ptr<ObjectCacheEntry> object;
+		//! The estimated memory usage of the entry, if any
+		optional_idx memory;
+		//! The position of the entry in the LRU list (only set if it has an estimated memory usage)
+		list<string>::iterator lru_position;
+	};
+
+	DUCKDB_API shared_ptr<ObjectCacheEntry> GetObjectInternal(const string &key);
+	DUCKDB_API void PutInternal(string key, shared_ptr<ObjectCacheEntry> value);
+	void DeleteInternal(const string &key);
+	//! Evicts the least recently used entries until the memory usage is within the limit
+	void EvictInternal();
+
 private:
 	//! Object Cache
-	unordered_map<string, shared_ptr<ObjectCacheEntry>> cache;
+	unordered_map<string, ObjectCacheValue> cache;
+	//! The keys of the entries that have an estimated memory usage, from most to least recently used
+	list<string> lru;
+	//! The summed estimated memory usage of the entries
+	idx_t memory_usage = 0;
+	//! The maximum memory usage
+	idx_t max_memory = NumericLimits<idx_t>::Maximum();
 	mutex lock;
 };
 
@@ -11,6 +11,7 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/map.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
@@ -61,6 +62,8 @@ public:
 
 	BufferHandle Pin(shared_ptr<BlockHandle> &handle) final;
 	void Unpin(shared_ptr<BlockHandle> &handle) final;
+	//! Load the given (persistent) blocks into memory, reading runs of adjacent blocks with a single read
+	void Prefetch(vector<shared_ptr<BlockHandle>> &handles) final;
 
 	//! Set a new memory limit to the buffer manager, throws an exception if the new limit is too low and not enough
 	//! blocks can be evicted
@@ -105,6 +108,13 @@ protected:
 	//! blocks that are never pinned are never added to the eviction queue
 	shared_ptr<BlockHandle> RegisterMemory(MemoryTag tag, idx_t block_size, bool can_destroy);
 
+	//! Read the blocks [first_block, last_block] with a single read and load them into their block handles
+	void BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+	               block_id_t first_block, block_id_t last_block);
+
+	//! Update the hit/miss counters and the access count (for the replacement policy) of a block that is pinned
+	void RegisterAccess(BlockHandle &handle, bool is_loaded);
+
 	//! Garbage collect eviction queue
 	void PurgeQueue() final;
 
@@ -155,6 +165,10 @@ protected:
 	unique_ptr<BlockManager> temp_block_manager;
 	//! Temporary evicted memory data per tag
 	atomic<idx_t> evicted_data_per_tag[MEMORY_TAG_COUNT];
+	//! The number of pins per tag of blocks that were already in memory
+	atomic<idx_t> buffer_hits_per_tag[MEMORY_TAG_COUNT];
+	//! The number of blocks per tag that had to be read from disk or from a temporary file
+	atomic<idx_t> buffer_misses_per_tag[MEMORY_TAG_COUNT];
 };
 
 } // namespace duckdb
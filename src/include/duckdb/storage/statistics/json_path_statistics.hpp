@@ -0,0 +1,59 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/json_path_statistics.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+class Serializer;
+class Deserializer;
+class Vector;
+
+//! The JSONPathStatistics are the statistics of the values at a path within the JSON objects of a column, e.g., of the
+//! values at $.user.id. They are computed during the checkpoint of a JSON column for the most frequent paths whose
+//! values have the same type in every row of the row group, and allow filters on extracted values to skip the row
+//! group (see JSONPathFilter).
+struct JSONPathStatistics {
+	JSONPathStatistics(vector<string> path, BaseStatistics stats);
+
+	//! The object keys that make up the path
+	vector<string> path;
+	//! The statistics of the (non-NULL) values at the path, the type is BIGINT, DOUBLE or VARCHAR
+	BaseStatistics stats;
+
+public:
+	JSONPathStatistics Copy() const;
+	string ToString() const;
+
+	void Serialize(Serializer &serializer) const;
+	static JSONPathStatistics Deserialize(Deserializer &deserializer);
+
+	//! Copies a set of path statistics
+	static vector<JSONPathStatistics> Copy(const vector<JSONPathStatistics> &statistics);
+	//! Returns the statistics of the given path, or nullptr if the path is not in the set
+	static optional_ptr<BaseStatistics> Find(vector<JSONPathStatistics> &statistics, const vector<string> &path);
+};
+
+//! The JSONPathStatisticsAnalyzer computes the JSONPathStatistics of a column while it is checkpointed. It is
+//! provided by the JSON extension, as parsing the values requires a JSON parser.
+class JSONPathStatisticsAnalyzer {
+public:
+	virtual ~JSONPathStatisticsAnalyzer() {
+	}
+
+	//! Analyzes the next values of the column, returns false if the column cannot have path statistics
+	virtual bool Analyze(Vector &input, idx_t count) = 0;
+	//! Returns the statistics of the frequent paths with a stable type
+	virtual vector<JSONPathStatistics> Finalize() = 0;
+};
+
+typedef unique_ptr<JSONPathStatisticsAnalyzer> (*json_path_statistics_analyzer_t)();
+
+} // namespace duckdb
@@ -44,6 +44,8 @@ struct Storage {
 	constexpr static const idx_t ROW_GROUP_SIZE = STANDARD_ROW_GROUPS_SIZE;
 	//! The number of vectors per row group
 	constexpr static const idx_t ROW_GROUP_VECTOR_COUNT = ROW_GROUP_SIZE / STANDARD_VECTOR_SIZE;
+	//! The maximum row group size that can be configured for a table (CREATE TABLE ... WITH (row_group_size = N))
+	constexpr static const idx_t MAX_ROW_GROUP_SIZE = 1ULL << 30ULL;
 };
 
 //! The version number of the database storage format
@@ -67,7 +67,9 @@ public:
 	virtual bool AutomaticCheckpoint(idx_t estimated_wal_bytes) = 0;
 	virtual unique_ptr<StorageCommitState> GenStorageCommitState(Transaction &transaction, bool checkpoint) = 0;
 	virtual bool IsCheckpointClean(MetaBlockPointer checkpoint_id) = 0;
-	virtual void CreateCheckpoint(bool delete_wal = false, bool force_checkpoint = false) = 0;
+	//! Create a checkpoint. If vacuum is set, every row group with deleted rows is rewritten and data stored near the
+	//! end of the database file is moved towards the front so that the file can be truncated.
+	virtual void CreateCheckpoint(bool delete_wal = false, bool force_checkpoint = false, bool vacuum = false) = 0;
 	virtual DatabaseSize GetDatabaseSize() = 0;
 	virtual vector<MetadataBlockInfo> GetMetadataInfo() = 0;
 	virtual shared_ptr<TableIOManager> GetTableIOManager(BoundCreateTableInfo *info) = 0;
@@ -111,11 +113,14 @@ public:
 	//! TableIoManager
 	unique_ptr<TableIOManager> table_io_manager;
 
+	//! The maximum amount of checkpoints performed by a single VACUUM to compact the database file
+	static constexpr const idx_t MAX_VACUUM_CHECKPOINTS = 3;
+
 public:
 	bool AutomaticCheckpoint(idx_t estimated_wal_bytes) override;
 	unique_ptr<StorageCommitState> GenStorageCommitState(Transaction &transaction, bool checkpoint) override;
 	bool IsCheckpointClean(MetaBlockPointer checkpoint_id) override;
-	void CreateCheckpoint(bool delete_wal, bool force_checkpoint) override;
+	void CreateCheckpoint(bool delete_wal, bool force_checkpoint, bool vacuum) override;
 	DatabaseSize GetDatabaseSize() override;
 	vector<MetadataBlockInfo> GetMetadataInfo() override;
 	shared_ptr<TableIOManager> GetTableIOManager(BoundCreateTableInfo *info) override;
@@ -33,6 +33,8 @@ struct ColumnCheckpointState {
 	ColumnSegmentTree new_tree;
 	vector<DataPointer> data_pointers;
 	unique_ptr<BaseStatistics> global_stats;
+	//! The statistics of the paths within the JSON objects of the column
+	vector<JSONPathStatistics> json_path_statistics;
 
 protected:
 	PartialBlockManager &partial_block_manager;
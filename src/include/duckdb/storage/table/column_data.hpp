@@ -13,6 +13,7 @@
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/table/persistent_table_data.hpp"
 #include "duckdb/storage/statistics/segment_statistics.hpp"
+#include "duckdb/storage/statistics/json_path_statistics.hpp"
 #include "duckdb/storage/table/segment_tree.hpp"
 #include "duckdb/storage/table/column_segment_tree.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -27,6 +28,7 @@ class TableDataWriter;
 class TableStorageInfo;
 struct TransactionData;
 struct TableScanOptions;
+struct PrefetchState;
 
 struct DataTableInfo;
 
@@ -80,6 +82,8 @@ public:
 	virtual void InitializeScan(ColumnScanState &state);
 	//! Initialize a scan starting at the specified offset
 	virtual void InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx);
+	//! Collect the blocks that the next "rows" rows of the scan will read from
+	virtual void InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state, idx_t rows);
 	//! Scan the next vector from the column
 	virtual idx_t Scan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result);
 	virtual idx_t ScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, bool allow_updates);
@@ -148,6 +152,11 @@ public:
 	void MergeIntoStatistics(BaseStatistics &other);
 	unique_ptr<BaseStatistics> GetStatistics();
 
+	//! Returns a copy of the statistics of the paths within the JSON objects of the column (if any)
+	vector<JSONPathStatistics> GetJSONPathStatistics();
+	//! Sets the statistics of the paths within the JSON objects of the column, which are computed at checkpoint
+	void SetJSONPathStatistics(vector<JSONPathStatistics> path_statistics);
+
 protected:
 	//! Append a transient segment
 	void AppendTransientSegment(SegmentLock &l, idx_t start_row);
@@ -170,6 +179,10 @@ protected:
 	unique_ptr<SegmentStatistics> stats;
 	//! Total transient allocation size
 	idx_t allocation_size;
+	//! The lock for the JSON path statistics
+	mutex json_path_statistics_lock;
+	//! The statistics of the paths within the JSON objects of the column, only valid until the column is modified
+	vector<JSONPathStatistics> json_path_statistics;
 };
 
 } // namespace duckdb
@@ -46,6 +46,8 @@ private:
 	vector<SegmentNode<ColumnSegment>> nodes;
 	vector<optional_ptr<CompressionFunction>> compression_functions;
 	ColumnCheckpointInfo &checkpoint_info;
+	//! Computes the statistics of the paths within the JSON objects of a JSON column (if any)
+	unique_ptr<JSONPathStatisticsAnalyzer> json_path_analyzer;
 };
 
 } // namespace duckdb
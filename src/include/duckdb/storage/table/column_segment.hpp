@@ -30,6 +30,7 @@ class TableFilter;
 struct ColumnFetchState;
 struct ColumnScanState;
 struct ColumnAppendState;
+struct PrefetchState;
 
 enum class ColumnSegmentType : uint8_t { TRANSIENT, PERSISTENT };
 //! TableFilter represents a filter pushed down into the table scan.
@@ -63,6 +64,8 @@ public:
 
 public:
 	void InitializeScan(ColumnScanState &state);
+	//! Add the on-disk block of this segment (if any) to the set of blocks to load ahead of the scan
+	void InitializePrefetch(PrefetchState &prefetch_state);
 	//! Scan one vector from this segment
 	void Scan(ColumnScanState &state, idx_t scan_count, Vector &result, idx_t result_offset, bool entire_vector);
 	//! Fetch a value of the specific row id and append it to the result
@@ -37,6 +37,8 @@ struct DataTableInfo {
 	TableIndexList indexes;
 	//! Index storage information of the indexes created by this table
 	vector<IndexStorageInfo> index_storage_infos;
+	//! The maximum number of rows per row group
+	idx_t row_group_size;
 
 	bool IsTemporary() const;
 };
@@ -162,6 +162,9 @@ private:
 	idx_t GetColumnCount() const;
 	vector<shared_ptr<ColumnData>> &GetColumns();
 
+	//! Load the on-disk blocks of the projected columns that the scan of this row group will read in advance
+	void PrefetchScan(CollectionScanState &state, idx_t row_offset);
+
 	template <TableScanType TYPE>
 	void TemplatedScan(TransactionData transaction, CollectionScanState &state, DataChunk &result);
 
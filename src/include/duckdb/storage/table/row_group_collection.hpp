@@ -90,9 +90,16 @@ public:
 
 	void Checkpoint(TableDataWriter &writer, TableStatistics &global_stats);
 
-	void InitializeVacuumState(VacuumState &state, vector<SegmentNode<RowGroup>> &segments);
+	void InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
+	                           vector<SegmentNode<RowGroup>> &segments);
 	bool ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state, idx_t segment_idx);
 	void ScheduleCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t segment_idx);
+	//! Returns the index of the first row group from which the zones of the cluster key overlap, or
+	//! DConstants::INVALID_INDEX if the row groups are already clustered
+	idx_t FindUnclusteredRowGroup(vector<SegmentNode<RowGroup>> &segments, VacuumState &state, idx_t column_idx);
+	//! Sorts the rows of all unclustered row groups on the cluster key and rewrites them into new row groups
+	void ClusterRowGroups(vector<SegmentNode<RowGroup>> &segments, VacuumState &state,
+	                      const vector<PhysicalIndex> &cluster_columns);
 
 	void CommitDropColumn(idx_t index);
 	void CommitDropTable();
@@ -123,6 +130,10 @@ public:
 	idx_t GetAllocationSize() const {
 		return allocation_size;
 	}
+	//! The maximum number of rows per row group
+	idx_t GetRowGroupSize() const;
+	//! The maximum number of vectors that are handed out to a single parallel scan task
+	idx_t GetParallelScanVectorCount() const;
 
 private:
 	bool IsEmpty(SegmentLock &) const;
@@ -16,6 +16,7 @@
 #include "duckdb/storage/table/segment_lock.hpp"
 
 namespace duckdb {
+class BlockHandle;
 class ColumnSegment;
 class LocalTableStorage;
 class CollectionScanState;
@@ -100,6 +101,13 @@ public:
 	void NextInternal(idx_t count);
 };
 
+struct PrefetchState {
+	//! The blocks that should be loaded ahead of the scan
+	vector<shared_ptr<BlockHandle>> blocks;
+
+	void AddBlock(shared_ptr<BlockHandle> block);
+};
+
 struct ColumnFetchState {
 	//! The set of pinned block handles for this set of fetches
 	buffer_handle_set_t handles;
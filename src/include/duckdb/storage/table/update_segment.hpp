@@ -101,7 +101,10 @@ struct UpdateNodeData {
 };
 
 struct UpdateNode {
-	unique_ptr<UpdateNodeData> info[Storage::ROW_GROUP_VECTOR_COUNT];
+	explicit UpdateNode(idx_t vector_count);
+	~UpdateNode();
+
+	vector<unique_ptr<UpdateNodeData>> info;
 };
 
 } // namespace duckdb
@@ -33,6 +33,8 @@ public:
 	void RollbackTransaction(Transaction &transaction) override;
 
 	void Checkpoint(ClientContext &context, bool force = false) override;
+	//! Checkpoint the database, rewriting every row group with deleted rows and truncating the database file
+	void Vacuum(ClientContext &context);
 
 	transaction_t LowestActiveId() {
 		return lowest_active_id;
@@ -53,6 +55,7 @@ protected:
 
 private:
 	CheckpointDecision CanCheckpoint(optional_ptr<DuckTransaction> current = nullptr);
+	void CheckpointInternal(ClientContext &context, bool force, bool vacuum);
 	//! Remove the given transaction from the list of active transactions
 	void RemoveTransaction(DuckTransaction &transaction) noexcept;
 
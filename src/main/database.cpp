@@ -370,6 +370,7 @@ void DatabaseInstance::Configure(DBConfig &new_config) {
 	} else {
 		config.buffer_pool = make_shared<BufferPool>(config.options.maximum_memory);
 	}
+	config.buffer_pool->SetReplacementPolicy(config.options.buffer_replacement_policy);
 }
 
 DBConfig &DBConfig::GetConfig(ClientContext &context) {
@@ -14,6 +14,7 @@
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
 namespace duckdb {
@@ -95,6 +96,26 @@ Value CheckpointThresholdSetting::GetSetting(ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Vacuum Delete Threshold
+//===--------------------------------------------------------------------===//
+void VacuumDeleteThresholdSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto threshold = input.GetValue<double>();
+	if (threshold < 0 || threshold > 1) {
+		throw InvalidInputException("vacuum_delete_threshold must be between 0 and 1");
+	}
+	config.options.vacuum_delete_threshold = threshold;
+}
+
+void VacuumDeleteThresholdSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.vacuum_delete_threshold = DBConfig().options.vacuum_delete_threshold;
+}
+
+Value VacuumDeleteThresholdSetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::DOUBLE(config.options.vacuum_delete_threshold);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -971,6 +992,44 @@ Value MaximumMemorySetting::GetSetting(ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.maximum_memory));
 }
 
+//===--------------------------------------------------------------------===//
+// Buffer Replacement Policy
+//===--------------------------------------------------------------------===//
+void BufferReplacementPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto policy = StringUtil::Lower(input.ToString());
+	if (policy == "lru") {
+		config.options.buffer_replacement_policy = BufferReplacementPolicy::LRU;
+	} else if (policy == "2q") {
+		config.options.buffer_replacement_policy = BufferReplacementPolicy::TWO_QUEUE;
+	} else {
+		throw InvalidInputException("Unrecognized buffer replacement policy \"%s\", expected lru or 2q", policy);
+	}
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetReplacementPolicy(
+		    config.options.buffer_replacement_policy);
+	}
+}
+
+void BufferReplacementPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.buffer_replacement_policy = DBConfig().options.buffer_replacement_policy;
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetReplacementPolicy(
+		    config.options.buffer_replacement_policy);
+	}
+}
+
+Value BufferReplacementPolicySetting::GetSetting(ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.buffer_replacement_policy) {
+	case BufferReplacementPolicy::LRU:
+		return "lru";
+	case BufferReplacementPolicy::TWO_QUEUE:
+		return "2q";
+	default:
+		throw InternalException("Unrecognized buffer replacement policy");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Old Implicit Casting
 //===--------------------------------------------------------------------===//
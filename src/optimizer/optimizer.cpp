@@ -90,6 +90,15 @@ unique_ptr<LogicalOperator> Optimizer::Optimize(unique_ptr<LogicalOperator> plan
 	}
 
 	this->plan = std::move(plan_p);
+	for (auto &optimizer_extension : DBConfig::GetConfig(context).optimizer_extensions) {
+		if (!optimizer_extension.pre_optimize_function) {
+			continue;
+		}
+		RunOptimizer(OptimizerType::EXTENSION, [&]() {
+			optimizer_extension.pre_optimize_function(context, optimizer_extension.optimizer_info.get(), plan);
+		});
+	}
+
 	// first we perform expression rewrites using the ExpressionRewriter
 	// this does not change the logical plan structure, but only simplifies the expression trees
 	RunOptimizer(OptimizerType::EXPRESSION_REWRITER, [&]() { rewriter.VisitOperator(*plan); });
@@ -192,6 +201,9 @@ unique_ptr<LogicalOperator> Optimizer::Optimize(unique_ptr<LogicalOperator> plan
 	});
 
 	for (auto &optimizer_extension : DBConfig::GetConfig(context).optimizer_extensions) {
+		if (!optimizer_extension.optimize_function) {
+			continue;
+		}
 		RunOptimizer(OptimizerType::EXTENSION, [&]() {
 			optimizer_extension.optimize_function(context, optimizer_extension.optimizer_info.get(), plan);
 		});
@@ -225,6 +225,22 @@ unique_ptr<AlterInfo> AlterForeignKeyInfo::Copy() const {
 	                                                      pk_keys, fk_keys, type);
 }
 
+//===--------------------------------------------------------------------===//
+// SetClusterByInfo
+//===--------------------------------------------------------------------===//
+SetClusterByInfo::SetClusterByInfo() : AlterTableInfo(AlterTableType::SET_CLUSTER_BY) {
+}
+
+SetClusterByInfo::SetClusterByInfo(AlterEntryData data, vector<string> cluster_by_p)
+    : AlterTableInfo(AlterTableType::SET_CLUSTER_BY, std::move(data)), cluster_by(std::move(cluster_by_p)) {
+}
+SetClusterByInfo::~SetClusterByInfo() {
+}
+
+unique_ptr<AlterInfo> SetClusterByInfo::Copy() const {
+	return make_uniq_base<AlterInfo, SetClusterByInfo>(GetAlterEntryData(), cluster_by);
+}
+
 //===--------------------------------------------------------------------===//
 // Alter View
 //===--------------------------------------------------------------------===//
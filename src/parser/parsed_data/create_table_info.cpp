@@ -26,6 +26,8 @@ unique_ptr<CreateInfo> CreateTableInfo::Copy() const {
 	if (query) {
 		result->query = unique_ptr_cast<SQLStatement, SelectStatement>(query->Copy());
 	}
+	result->row_group_size = row_group_size;
+	result->cluster_by = cluster_by;
 	return std::move(result);
 }
 
@@ -37,11 +39,27 @@ string CreateTableInfo::ToString() const {
 		table_name = KeywordHelper::WriteOptionallyQuoted(schema) + "." + table_name;
 	}
 
+	vector<string> option_list;
+	if (row_group_size != Storage::ROW_GROUP_SIZE) {
+		option_list.push_back("row_group_size = " + to_string(row_group_size));
+	}
+	if (!cluster_by.empty()) {
+		vector<string> key;
+		for (auto &column : cluster_by) {
+			key.push_back(KeywordHelper::WriteOptionallyQuoted(column));
+		}
+		option_list.push_back("cluster_by = " + KeywordHelper::WriteQuoted(StringUtil::Join(key, ", ")));
+	}
+	string options;
+	if (!option_list.empty()) {
+		options = " WITH (" + StringUtil::Join(option_list, ", ") + ")";
+	}
+
 	ret += "CREATE TABLE " + table_name;
 	if (query != nullptr) {
-		ret += " AS " + query->ToString();
+		ret += options + " AS " + query->ToString();
 	} else {
-		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints) + ";";
+		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints) + options + ";";
 	}
 	return ret;
 }
@@ -93,6 +93,28 @@ unique_ptr<AlterStatement> Transformer::TransformAlter(duckdb_libpgquery::PGAlte
 			result->info = make_uniq<DropNotNullInfo>(std::move(data), command->name);
 			break;
 		}
+		case duckdb_libpgquery::PG_AT_SetRelOptions:
+		case duckdb_libpgquery::PG_AT_ResetRelOptions: {
+			if (stmt.relkind != duckdb_libpgquery::PG_OBJECT_TABLE) {
+				throw ParserException("Setting storage options is only supported for tables");
+			}
+			bool reset = command->subtype == duckdb_libpgquery::PG_AT_ResetRelOptions;
+			auto options = PGPointerCast<duckdb_libpgquery::PGList>(command->def);
+			if (!options || options->length != 1) {
+				throw ParserException("Only one storage option per ALTER TABLE statement is supported");
+			}
+			auto def_elem = PGPointerCast<duckdb_libpgquery::PGDefElem>(options->head->data.ptr_value);
+			auto option_name = StringUtil::Lower(def_elem->defname);
+			if (option_name != "cluster_by") {
+				throw NotImplementedException("Unrecognized option \"%s\" for ALTER TABLE", option_name);
+			}
+			vector<string> cluster_by;
+			if (!reset) {
+				cluster_by = TransformClusterBy(TransformTableOptionValue(*def_elem));
+			}
+			result->info = make_uniq<SetClusterByInfo>(std::move(data), std::move(cluster_by));
+			break;
+		}
 		case duckdb_libpgquery::PG_AT_DropConstraint:
 		default:
 			throw NotImplementedException("No support for that ALTER TABLE option yet!");
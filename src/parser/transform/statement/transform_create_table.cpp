@@ -4,6 +4,8 @@
 #include "duckdb/parser/constraint.hpp"
 #include "duckdb/parser/expression/collate_expression.hpp"
 #include "duckdb/catalog/catalog_entry/table_column_type.hpp"
+#include "duckdb/parser/expression/constant_expression.hpp"
+#include "duckdb/storage/storage_info.hpp"
 
 namespace duckdb {
 
@@ -66,6 +68,132 @@ ColumnDefinition Transformer::TransformColumnDefinition(duckdb_libpgquery::PGCol
 	return ColumnDefinition(colname, target_type);
 }
 
+Value Transformer::TransformTableOptionValue(duckdb_libpgquery::PGDefElem &def_elem) {
+	if (!def_elem.arg) {
+		throw ParserException("Expected an argument for option %s", def_elem.defname);
+	}
+	auto arg = PGPointerCast<duckdb_libpgquery::PGNode>(def_elem.arg);
+	switch (arg->type) {
+	case duckdb_libpgquery::T_PGInteger:
+	case duckdb_libpgquery::T_PGFloat:
+	case duckdb_libpgquery::T_PGString:
+		return TransformValue(*PGPointerCast<duckdb_libpgquery::PGValue>(def_elem.arg))->value;
+	default:
+		throw ParserException("Expected a constant argument for option %s", def_elem.defname);
+	}
+}
+
+static bool IsClusterByIdentifierCharacter(char c) {
+	return StringUtil::CharacterIsAlpha(c) || StringUtil::CharacterIsDigit(c) || c == '_' || (c & 0x80);
+}
+
+//! Parses the next (optionally double-quoted) column name of a cluster key starting at pos. The key is parsed by hand
+//! as the transformer cannot re-enter the parser.
+static string ParseClusterByColumn(const string &key, idx_t &pos) {
+	string name;
+	while (pos < key.size() && StringUtil::CharacterIsSpace(key[pos])) {
+		pos++;
+	}
+	auto start = pos;
+	if (pos < key.size() && key[pos] == '"') {
+		// quoted identifier - "" is an escaped quote
+		pos++;
+		while (true) {
+			if (pos >= key.size()) {
+				throw ParserException("Unterminated quoted identifier in cluster_by \"%s\"", key);
+			}
+			if (key[pos] == '"') {
+				if (pos + 1 < key.size() && key[pos + 1] == '"') {
+					name += '"';
+					pos += 2;
+					continue;
+				}
+				pos++;
+				break;
+			}
+			name += key[pos++];
+		}
+	} else {
+		while (pos < key.size() && IsClusterByIdentifierCharacter(key[pos])) {
+			name += key[pos++];
+		}
+		if (!name.empty() && StringUtil::CharacterIsDigit(name[0])) {
+			name.clear();
+		}
+	}
+	while (pos < key.size() && StringUtil::CharacterIsSpace(key[pos])) {
+		pos++;
+	}
+	if (pos < key.size() && key[pos] == '.' && !name.empty()) {
+		throw ParserException("cluster_by only supports unqualified column names, found \"%s\"",
+		                      StringUtil::Split(key.substr(start), ',')[0]);
+	}
+	if (name.empty() || (pos < key.size() && key[pos] != ',')) {
+		auto end = key.find(',', start);
+		auto item = key.substr(start, end == string::npos ? string::npos : end - start);
+		StringUtil::Trim(item);
+		throw ParserException("cluster_by only supports plain column names, found \"%s\"", item);
+	}
+	return name;
+}
+
+vector<string> Transformer::TransformClusterBy(const Value &value) {
+	vector<string> result;
+	if (value.IsNull() || value.type().id() != LogicalTypeId::VARCHAR) {
+		throw ParserException("cluster_by expects a string with a comma-separated list of column names");
+	}
+	auto key = StringValue::Get(value);
+	StringUtil::Trim(key);
+	if (key.empty()) {
+		return result;
+	}
+	case_insensitive_set_t seen;
+	idx_t pos = 0;
+	while (true) {
+		auto name = ParseClusterByColumn(key, pos);
+		if (seen.find(name) != seen.end()) {
+			throw ParserException("Column \"%s\" appears more than once in cluster_by", name);
+		}
+		seen.insert(name);
+		result.push_back(std::move(name));
+		if (pos >= key.size()) {
+			break;
+		}
+		// skip the comma
+		pos++;
+	}
+	return result;
+}
+
+void Transformer::TransformTableOptions(duckdb_libpgquery::PGList *options, CreateTableInfo &info) {
+	if (!options) {
+		return;
+	}
+	duckdb_libpgquery::PGListCell *cell;
+	for_each_cell(cell, options->head) {
+		auto def_elem = PGPointerCast<duckdb_libpgquery::PGDefElem>(cell->data.ptr_value);
+		auto option_name = StringUtil::Lower(def_elem->defname);
+		if (option_name == "row_group_size") {
+			auto val = TransformTableOptionValue(*def_elem);
+			if (!val.DefaultTryCastAs(LogicalType::UBIGINT)) {
+				throw ParserException("Expected an integer argument for option %s", option_name);
+			}
+			auto row_group_size = val.GetValue<uint64_t>();
+			if (row_group_size < STANDARD_VECTOR_SIZE || row_group_size > Storage::MAX_ROW_GROUP_SIZE ||
+			    row_group_size % STANDARD_VECTOR_SIZE != 0) {
+				throw ParserException("row_group_size must be a multiple of %llu between %llu and %llu",
+				                      idx_t(STANDARD_VECTOR_SIZE), idx_t(STANDARD_VECTOR_SIZE),
+				                      Storage::MAX_ROW_GROUP_SIZE);
+			}
+			info.row_group_size = row_group_size;
+		} else if (option_name == "cluster_by") {
+			info.cluster_by = TransformClusterBy(TransformTableOptionValue(*def_elem));
+		} else {
+			throw NotImplementedException("Unrecognized option \"%s\" for CREATE TABLE", option_name);
+		}
+	}
+}
+
 unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery::PGCreateStmt &stmt) {
 	auto result = make_uniq<CreateStatement>();
 	auto info = make_uniq<CreateTableInfo>();
@@ -123,6 +251,7 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery:
 	if (!column_count) {
 		throw ParserException("Table must have at least one column!");
 	}
+	TransformTableOptions(stmt.options, *info);
 
 	result->info = std::move(info);
 	return result;
@@ -20,6 +20,7 @@
 #include "duckdb/planner/expression_binder/index_binder.hpp"
 #include "duckdb/parser/parsed_data/create_index_info.hpp"
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 
 #include <algorithm>
 
@@ -287,6 +288,7 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 	if (base.columns.PhysicalColumnCount() == 0) {
 		throw BinderException("Creating a table without physical (non-generated) columns is not supported");
 	}
+	TableCatalogEntry::BindClusterBy(base.columns, base.cluster_by);
 	// bind collations to detect any unsupported collation errors
 	for (idx_t i = 0; i < base.columns.PhysicalColumnCount(); i++) {
 		auto &column = base.columns.GetColumnMutable(PhysicalIndex(i));
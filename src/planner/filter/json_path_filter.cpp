@@ -0,0 +1,84 @@
+#include "duckdb/planner/filter/json_path_filter.hpp"
+
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+
+namespace duckdb {
+
+JSONPathFilter::JSONPathFilter(vector<string> path_p, unique_ptr<TableFilter> child_filter_p)
+    : TableFilter(TableFilterType::JSON_PATH), path(std::move(path_p)), child_filter(std::move(child_filter_p)) {
+}
+
+FilterPropagateResult JSONPathFilter::CheckStatistics(BaseStatistics &stats) {
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+FilterPropagateResult JSONPathFilter::CheckPathStatistics(vector<JSONPathStatistics> &path_statistics) {
+	auto stats = JSONPathStatistics::Find(path_statistics, path);
+	if (!stats || child_filter->filter_type != TableFilterType::CONSTANT_COMPARISON) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto &constant_type = child_filter->Cast<ConstantFilter>().constant.type();
+	if (stats->GetType() == constant_type) {
+		return child_filter->CheckStatistics(*stats);
+	}
+	// The extracted text of an integer is cast to the type of the constant, the BIGINT statistics can be cast to the
+	// other integer types and to DOUBLE, as these casts preserve the order of the values
+	if (stats->GetType().id() != LogicalTypeId::BIGINT || !NumericStats::HasMinMax(*stats)) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	if (!constant_type.IsIntegral() && constant_type.id() != LogicalTypeId::DOUBLE) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	Value min;
+	Value max;
+	if (!NumericStats::Min(*stats).DefaultTryCastAs(constant_type, min, nullptr, true) ||
+	    !NumericStats::Max(*stats).DefaultTryCastAs(constant_type, max, nullptr, true)) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto cast_stats = NumericStats::CreateEmpty(constant_type);
+	NumericStats::SetMin(cast_stats, min);
+	NumericStats::SetMax(cast_stats, max);
+	cast_stats.CopyValidity(*stats);
+	return child_filter->CheckStatistics(cast_stats);
+}
+
+FilterPropagateResult JSONPathFilter::CheckPathStatistics(TableFilter &filter,
+                                                          vector<JSONPathStatistics> &path_statistics) {
+	switch (filter.filter_type) {
+	case TableFilterType::JSON_PATH:
+		return filter.Cast<JSONPathFilter>().CheckPathStatistics(path_statistics);
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_and = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction_and.child_filters) {
+			auto prune_result = CheckPathStatistics(*child_filter, path_statistics);
+			if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE ||
+			    prune_result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
+				return prune_result;
+			}
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+string JSONPathFilter::ToString(const string &column_name) {
+	string path_str = "$";
+	for (auto &key : path) {
+		path_str += "." + key;
+	}
+	return child_filter->ToString(column_name + "->>'" + path_str + "'");
+}
+
+bool JSONPathFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<JSONPathFilter>();
+	return other.path == path && other.child_filter->Equals(*child_filter);
+}
+
+} // namespace duckdb
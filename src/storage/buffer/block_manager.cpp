@@ -10,7 +10,7 @@ BlockManager::BlockManager(BufferManager &buffer_manager)
     : buffer_manager(buffer_manager), metadata_manager(make_uniq<MetadataManager>(*this, buffer_manager)) {
 }
 
-shared_ptr<BlockHandle> BlockManager::RegisterBlock(block_id_t block_id) {
+shared_ptr<BlockHandle> BlockManager::RegisterBlock(block_id_t block_id, MemoryTag tag) {
 	lock_guard<mutex> lock(blocks_lock);
 	// check if the block already exists
 	auto entry = blocks.find(block_id);
@@ -23,7 +23,7 @@ shared_ptr<BlockHandle> BlockManager::RegisterBlock(block_id_t block_id) {
 		}
 	}
 	// create a new block pointer for this block
-	auto result = make_shared<BlockHandle>(*this, block_id, MemoryTag::BASE_TABLE);
+	auto result = make_shared<BlockHandle>(*this, block_id, tag);
 	// register the block pointer in the set of blocks as a weak pointer
 	blocks[block_id] = weak_ptr<BlockHandle>(result);
 	return result;
@@ -40,7 +40,7 @@ shared_ptr<BlockHandle> BlockManager::ConvertToPersistent(block_id_t block_id, s
 	D_ASSERT(old_block->buffer->AllocSize() <= Storage::BLOCK_ALLOC_SIZE);
 
 	// register a block with the new block id
-	auto new_block = RegisterBlock(block_id);
+	auto new_block = RegisterBlock(block_id, old_block->tag);
 	D_ASSERT(new_block->state == BlockState::BLOCK_UNLOADED);
 	D_ASSERT(new_block->readers == 0);
 
@@ -10,6 +10,14 @@ typedef duckdb_moodycamel::ConcurrentQueue<BufferEvictionNode> eviction_queue_t;
 
 struct EvictionQueue {
 	eviction_queue_t q;
+	//! Total dead nodes in the eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
+	//! handle, or (2) we insert a newer version into one of the eviction queues.
+	atomic<idx_t> total_dead_nodes {0};
+	//! Locked, if a queue purge is currently active or we're trying to forcefully evict a node.
+	//! Only lets a single thread enter the purge phase.
+	mutex purge_lock;
+	//! A pre-allocated vector of eviction nodes. We reuse this to keep the allocation overhead of purges small.
+	vector<BufferEvictionNode> purge_nodes;
 };
 
 bool BufferEvictionNode::CanUnload(BlockHandle &handle_p) {
@@ -35,8 +43,11 @@ shared_ptr<BlockHandle> BufferEvictionNode::TryGetBlockHandle() {
 }
 
 BufferPool::BufferPool(idx_t maximum_memory)
-    : current_memory(0), maximum_memory(maximum_memory), queue(make_uniq<EvictionQueue>()),
-      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()), evict_queue_insertions(0), total_dead_nodes(0) {
+    : current_memory(0), maximum_memory(maximum_memory), replacement_policy(BufferReplacementPolicy::LRU),
+      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()), evict_queue_insertions(0) {
+	for (idx_t i = 0; i < EVICTION_QUEUE_COUNT; i++) {
+		queues.push_back(make_uniq<EvictionQueue>());
+	}
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
 		memory_usage_per_tag[i] = 0;
 	}
@@ -51,14 +62,16 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	D_ASSERT(handle->readers == 0);
 	auto ts = ++handle->eviction_timestamp;
+	auto queue_idx = GetEvictionQueueIndex(*handle);
 
 	BufferEvictionNode evict_node(weak_ptr<BlockHandle>(handle), ts);
-	queue->q.enqueue(evict_node);
+	queues[queue_idx]->q.enqueue(evict_node);
 
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		IncrementDeadNodes();
+		IncrementDeadNodes(*handle);
 	}
+	handle->eviction_queue_idx = queue_idx;
 
 	if (++evict_queue_insertions % INSERT_INTERVAL == 0) {
 		return true;
@@ -66,6 +79,42 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 	return false;
 }
 
+idx_t BufferPool::GetEvictionPriority(MemoryTag tag) {
+	switch (tag) {
+	case MemoryTag::ART_INDEX:
+	case MemoryTag::METADATA:
+		// index and metadata blocks are used by most queries: evict them only after all other blocks
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+idx_t BufferPool::GetEvictionQueueIndex(BlockHandle &handle) const {
+	auto priority = GetEvictionPriority(handle.tag);
+	D_ASSERT(priority < EVICTION_PRIORITY_COUNT);
+	bool is_protected = true;
+	if (replacement_policy == BufferReplacementPolicy::TWO_QUEUE) {
+		// blocks that have only been used once since they were loaded are on probation
+		is_protected = handle.access_count > 1;
+	}
+	return priority * 2 + (is_protected ? 1 : 0);
+}
+
+void BufferPool::IncrementDeadNodes(BlockHandle &handle) {
+	if (handle.eviction_queue_idx < queues.size()) {
+		queues[handle.eviction_queue_idx]->total_dead_nodes++;
+	}
+}
+
+void BufferPool::SetReplacementPolicy(BufferReplacementPolicy policy) {
+	replacement_policy = policy;
+}
+
+BufferReplacementPolicy BufferPool::GetReplacementPolicy() const {
+	return replacement_policy;
+}
+
 void BufferPool::IncreaseUsedMemory(MemoryTag tag, idx_t size) {
 	current_memory += size;
 	memory_usage_per_tag[uint8_t(tag)] += size;
@@ -93,21 +142,34 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
 	TempBufferPoolReservation r(tag, *this, extra_memory);
 
 	while (current_memory > memory_limit) {
-		// get a block to unpin from the queue
-		if (!queue->q.try_dequeue(node)) {
+		// get a block to unpin from the first non-empty queue
+		optional_ptr<EvictionQueue> queue;
+		for (auto &candidate : queues) {
+			if (candidate->q.try_dequeue(node)) {
+				queue = candidate.get();
+				break;
+			}
+		}
+		if (!queue) {
 			// we could not dequeue any eviction node, so we try one more time,
 			// but more aggressively
-			if (!TryDequeueWithLock(node)) {
-				// still no success, we return
-				r.Resize(0);
-				return {false, std::move(r)};
+			for (auto &candidate : queues) {
+				if (TryDequeueWithLock(*candidate, node)) {
+					queue = candidate.get();
+					break;
+				}
 			}
 		}
+		if (!queue) {
+			// still no success, we return
+			r.Resize(0);
+			return {false, std::move(r)};
+		}
 
 		// get a reference to the underlying block pointer
 		auto handle = node.TryGetBlockHandle();
 		if (!handle) {
-			DecrementDeadNodes();
+			queue->total_dead_nodes--;
 			continue;
 		}
 
@@ -115,7 +177,7 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
 		lock_guard<mutex> lock(handle->lock);
 		if (!node.CanUnload(*handle)) {
 			// something changed in the mean-time, bail out
-			DecrementDeadNodes();
+			queue->total_dead_nodes--;
 			continue;
 		}
 
@@ -132,22 +194,23 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
 	return {true, std::move(r)};
 }
 
-bool BufferPool::TryDequeueWithLock(BufferEvictionNode &node) {
-	lock_guard<mutex> lock(purge_lock);
-	return queue->q.try_dequeue(node);
+bool BufferPool::TryDequeueWithLock(EvictionQueue &queue, BufferEvictionNode &node) {
+	lock_guard<mutex> lock(queue.purge_lock);
+	return queue.q.try_dequeue(node);
 }
 
-void BufferPool::PurgeIteration(const idx_t purge_size) {
+void BufferPool::PurgeIteration(EvictionQueue &queue, const idx_t purge_size) {
 	// if this purge is significantly smaller or bigger than the previous purge, then
 	// we need to resize the purge_nodes vector. Note that this barely happens, as we
 	// purge queue_insertions * PURGE_SIZE_MULTIPLIER nodes
+	auto &purge_nodes = queue.purge_nodes;
 	idx_t previous_purge_size = purge_nodes.size();
 	if (purge_size < previous_purge_size / 2 || purge_size > previous_purge_size) {
 		purge_nodes.resize(purge_size);
 	}
 
 	// bulk purge
-	idx_t actually_dequeued = queue->q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
+	idx_t actually_dequeued = queue.q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
 
 	// retrieve all alive nodes that have been wrongly dequeued
 	idx_t alive_nodes = 0;
@@ -155,27 +218,33 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 		auto &node = purge_nodes[i];
 		auto handle = node.TryGetBlockHandle();
 		if (handle) {
-			queue->q.enqueue(std::move(node));
+			queue.q.enqueue(std::move(node));
 			alive_nodes++;
 		}
 	}
 
-	total_dead_nodes -= actually_dequeued - alive_nodes;
+	queue.total_dead_nodes -= actually_dequeued - alive_nodes;
 }
 
 void BufferPool::PurgeQueue() {
+	for (auto &queue : queues) {
+		PurgeQueue(*queue);
+	}
+}
+
+void BufferPool::PurgeQueue(EvictionQueue &queue) {
 
 	// only one thread purges the queue, all other threads early-out
-	if (!purge_lock.try_lock()) {
+	if (!queue.purge_lock.try_lock()) {
 		return;
 	}
-	lock_guard<mutex> lock {purge_lock, std::adopt_lock};
+	lock_guard<mutex> lock {queue.purge_lock, std::adopt_lock};
 
 	// we purge INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER nodes
 	idx_t purge_size = INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER;
 
 	// get an estimate of the queue size as-of now
-	idx_t approx_q_size = queue->q.size_approx();
+	idx_t approx_q_size = queue.q.size_approx();
 
 	// early-out, if the queue is not big enough to justify purging
 	// - we want to keep the LRU characteristic alive
@@ -202,17 +271,17 @@ void BufferPool::PurgeQueue() {
 	idx_t max_purges = approx_q_size / purge_size;
 	while (max_purges != 0) {
 
-		PurgeIteration(purge_size);
+		PurgeIteration(queue, purge_size);
 
 		// update relevant sizes and potentially early-out
-		approx_q_size = queue->q.size_approx();
+		approx_q_size = queue.q.size_approx();
 
 		// early-out according to (2.1)
 		if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
 			break;
 		}
 
-		idx_t approx_dead_nodes = total_dead_nodes;
+		idx_t approx_dead_nodes = queue.total_dead_nodes;
 		approx_dead_nodes = approx_dead_nodes > approx_q_size ? approx_q_size : approx_dead_nodes;
 		idx_t approx_alive_nodes = approx_q_size - approx_dead_nodes;
 
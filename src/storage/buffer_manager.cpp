@@ -16,6 +16,9 @@ Allocator &BufferManager::GetBufferAllocator() {
 	throw NotImplementedException("This type of BufferManager does not have an Allocator");
 }
 
+void BufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
+}
+
 void BufferManager::ReserveMemory(idx_t size) {
 	throw NotImplementedException("This type of BufferManager can not reserve memory");
 }
@@ -6,6 +6,7 @@
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/storage/table/table_statistics.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/main/config.hpp"
 
 namespace duckdb {
 
@@ -25,6 +26,22 @@ CompressionType TableDataWriter::GetColumnCompressionType(idx_t i) {
 	return table.GetColumn(LogicalIndex(i)).CompressionType();
 }
 
+vector<PhysicalIndex> TableDataWriter::GetClusterColumns() {
+	vector<PhysicalIndex> result;
+	for (auto &name : table.GetClusterBy()) {
+		result.push_back(table.GetColumn(name).Physical());
+	}
+	return result;
+}
+
+double TableDataWriter::GetVacuumDeleteThreshold() {
+	return DBConfig::Get(table.ParentCatalog().GetAttached()).options.vacuum_delete_threshold;
+}
+
+block_id_t TableDataWriter::GetCompactionBlock() {
+	return INVALID_BLOCK;
+}
+
 void TableDataWriter::AddRowGroup(RowGroupPointer &&row_group_pointer, unique_ptr<RowGroupWriter> writer) {
 	row_group_pointers.push_back(std::move(row_group_pointer));
 }
@@ -42,6 +59,14 @@ unique_ptr<RowGroupWriter> SingleFileTableDataWriter::GetRowGroupWriter(RowGroup
 	return make_uniq<SingleFileRowGroupWriter>(table, checkpoint_manager.partial_block_manager, table_data_writer);
 }
 
+double SingleFileTableDataWriter::GetVacuumDeleteThreshold() {
+	return checkpoint_manager.GetVacuumDeleteThreshold();
+}
+
+block_id_t SingleFileTableDataWriter::GetCompactionBlock() {
+	return checkpoint_manager.GetCompactionBlock();
+}
+
 void SingleFileTableDataWriter::FinalizeTable(const TableStatistics &global_stats, DataTableInfo *info,
                                               Serializer &serializer) {
 	// store the current position in the metadata writer
@@ -35,8 +35,25 @@ namespace duckdb {
 
 void ReorderTableEntries(catalog_entry_vector_t &tables);
 
-SingleFileCheckpointWriter::SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager)
-    : CheckpointWriter(db), partial_block_manager(block_manager, CheckpointType::FULL_CHECKPOINT) {
+SingleFileCheckpointWriter::SingleFileCheckpointWriter(AttachedDatabase &db, BlockManager &block_manager, bool vacuum)
+    : CheckpointWriter(db), vacuum(vacuum), compaction_block(INVALID_BLOCK),
+      partial_block_manager(block_manager, CheckpointType::FULL_CHECKPOINT) {
+	if (vacuum) {
+		// every block that is in use at or after this point corresponds to a free block before it
+		// rewriting the data in these blocks moves it to the front, after which the file can be truncated
+		auto used_blocks = block_manager.TotalBlocks() - block_manager.FreeBlocks();
+		if (used_blocks < block_manager.TotalBlocks()) {
+			compaction_block = NumericCast<block_id_t>(used_blocks);
+		}
+	}
+}
+
+double SingleFileCheckpointWriter::GetVacuumDeleteThreshold() const {
+	if (vacuum) {
+		// VACUUM reclaims the space of all deleted rows
+		return 0;
+	}
+	return DBConfig::Get(db).options.vacuum_delete_threshold;
 }
 
 BlockManager &SingleFileCheckpointWriter::GetBlockManager() {
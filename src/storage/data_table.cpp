@@ -31,7 +31,7 @@ namespace duckdb {
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
     : db(db), table_io_manager(std::move(table_io_manager_p)), cardinality(0), schema(std::move(schema)),
-      table(std::move(table)) {
+      table(std::move(table)), row_group_size(Storage::ROW_GROUP_SIZE) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context) {
@@ -44,9 +44,10 @@ bool DataTableInfo::IsTemporary() const {
 
 DataTable::DataTable(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, const string &schema,
                      const string &table, vector<ColumnDefinition> column_definitions_p,
-                     unique_ptr<PersistentTableData> data)
+                     unique_ptr<PersistentTableData> data, idx_t row_group_size)
     : info(make_shared<DataTableInfo>(db, std::move(table_io_manager_p), schema, table)),
       column_definitions(std::move(column_definitions_p)), db(db), is_root(true) {
+	info->row_group_size = row_group_size;
 	// initialize the table with the existing data from disk, if any
 	auto types = GetTypes();
 	this->row_groups =
@@ -218,7 +219,7 @@ void DataTable::InitializeScanWithOffset(TableScanState &state, const vector<col
 }
 
 idx_t DataTable::MaxThreads(ClientContext &context) {
-	idx_t parallel_scan_vector_count = Storage::ROW_GROUP_VECTOR_COUNT;
+	idx_t parallel_scan_vector_count = row_groups->GetParallelScanVectorCount();
 	if (ClientConfig::GetConfig(context).verify_parallelism) {
 		parallel_scan_vector_count = 1;
 	}
@@ -1255,6 +1256,10 @@ idx_t DataTable::GetTotalRows() {
 	return row_groups->GetTotalRows();
 }
 
+idx_t DataTable::GetRowGroupSize() const {
+	return info->row_group_size;
+}
+
 void DataTable::CommitDropTable() {
 	// commit a drop of this table: mark all blocks as modified, so they can be reclaimed later on
 	row_groups->CommitDropTable();
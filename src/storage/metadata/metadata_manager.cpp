@@ -107,7 +107,7 @@ void MetadataManager::AddAndRegisterBlock(MetadataBlock block) {
 	if (block.block) {
 		throw InternalException("Calling AddAndRegisterBlock on block that already exists");
 	}
-	block.block = block_manager.RegisterBlock(block.block_id);
+	block.block = block_manager.RegisterBlock(block.block_id, MemoryTag::METADATA);
 	AddBlock(std::move(block), true);
 }
 
@@ -0,0 +1,80 @@
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+
+shared_ptr<ObjectCacheEntry> ObjectCache::GetObjectInternal(const string &key) {
+	auto entry = cache.find(key);
+	if (entry == cache.end()) {
+		return nullptr;
+	}
+	auto &value = entry->second;
+	if (value.memory.IsValid()) {
+		// move the entry to the front of the LRU list
+		lru.splice(lru.begin(), lru, value.lru_position);
+	}
+	return value.object;
+}
+
+void ObjectCache::PutInternal(string key, shared_ptr<ObjectCacheEntry> object) {
+	DeleteInternal(key);
+
+	ObjectCacheValue value;
+	value.memory = object ? object->GetEstimatedCacheMemory() : optional_idx();
+	value.object = std::move(object);
+	if (value.memory.IsValid()) {
+		lru.push_front(key);
+		value.lru_position = lru.begin();
+		memory_usage += value.memory.GetIndex();
+	}
+	cache.insert(make_pair(std::move(key), std::move(value)));
+	EvictInternal();
+}
+
+void ObjectCache::DeleteInternal(const string &key) {
+	auto entry = cache.find(key);
+	if (entry == cache.end()) {
+		return;
+	}
+	auto &value = entry->second;
+	if (value.memory.IsValid()) {
+		memory_usage -= value.memory.GetIndex();
+		lru.erase(value.lru_position);
+	}
+	cache.erase(entry);
+}
+
+void ObjectCache::EvictInternal() {
+	while (memory_usage > max_memory && !lru.empty()) {
+		// copy the key: deleting the entry erases it from the LRU list
+		auto key = lru.back();
+		DeleteInternal(key);
+	}
+}
+
+void ObjectCache::Put(string key, shared_ptr<ObjectCacheEntry> value) {
+	lock_guard<mutex> glock(lock);
+	PutInternal(std::move(key), std::move(value));
+}
+
+void ObjectCache::Delete(const string &key) {
+	lock_guard<mutex> glock(lock);
+	DeleteInternal(key);
+}
+
+void ObjectCache::SetMaxMemory(idx_t max_memory_p) {
+	lock_guard<mutex> glock(lock);
+	max_memory = max_memory_p;
+	EvictInternal();
+}
+
+idx_t ObjectCache::GetMaxMemory() {
+	lock_guard<mutex> glock(lock);
+	return max_memory;
+}
+
+idx_t ObjectCache::GetMemoryUsage() {
+	lock_guard<mutex> glock(lock);
+	return memory_usage;
+}
+
+} // namespace duckdb
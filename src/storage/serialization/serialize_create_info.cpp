@@ -157,6 +157,8 @@ void CreateTableInfo::Serialize(Serializer &serializer) const {
 	serializer.WriteProperty<ColumnList>(201, "columns", columns);
 	serializer.WritePropertyWithDefault<vector<unique_ptr<Constraint>>>(202, "constraints", constraints);
 	serializer.WritePropertyWithDefault<unique_ptr<SelectStatement>>(203, "query", query);
+	serializer.WritePropertyWithDefault<idx_t>(204, "row_group_size", row_group_size, idx_t(Storage::ROW_GROUP_SIZE));
+	serializer.WritePropertyWithDefault<vector<string>>(205, "cluster_by", cluster_by);
 }
 
 unique_ptr<CreateInfo> CreateTableInfo::Deserialize(Deserializer &deserializer) {
@@ -165,6 +167,8 @@ unique_ptr<CreateInfo> CreateTableInfo::Deserialize(Deserializer &deserializer)
 	deserializer.ReadProperty<ColumnList>(201, "columns", result->columns);
 	deserializer.ReadPropertyWithDefault<vector<unique_ptr<Constraint>>>(202, "constraints", result->constraints);
 	deserializer.ReadPropertyWithDefault<unique_ptr<SelectStatement>>(203, "query", result->query);
+	deserializer.ReadPropertyWithDefault<idx_t>(204, "row_group_size", result->row_group_size, idx_t(Storage::ROW_GROUP_SIZE));
+	deserializer.ReadPropertyWithDefault<vector<string>>(205, "cluster_by", result->cluster_by);
 	return std::move(result);
 }
 
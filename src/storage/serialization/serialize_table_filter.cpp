@@ -10,6 +10,7 @@
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
+#include "duckdb/planner/filter/json_path_filter.hpp"
 
 namespace duckdb {
 
@@ -36,6 +37,9 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	case TableFilterType::IS_NULL:
 		result = IsNullFilter::Deserialize(deserializer);
 		break;
+	case TableFilterType::JSON_PATH:
+		result = JSONPathFilter::Deserialize(deserializer);
+		break;
 	case TableFilterType::STRUCT_EXTRACT:
 		result = StructFilter::Deserialize(deserializer);
 		break;
@@ -98,6 +102,19 @@ unique_ptr<TableFilter> IsNullFilter::Deserialize(Deserializer &deserializer) {
 	return std::move(result);
 }
 
+void JSONPathFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+	serializer.WritePropertyWithDefault<vector<string>>(200, "path", path);
+	serializer.WritePropertyWithDefault<unique_ptr<TableFilter>>(201, "child_filter", child_filter);
+}
+
+unique_ptr<TableFilter> JSONPathFilter::Deserialize(Deserializer &deserializer) {
+	auto path = deserializer.ReadPropertyWithDefault<vector<string>>(200, "path");
+	auto child_filter = deserializer.ReadPropertyWithDefault<unique_ptr<TableFilter>>(201, "child_filter");
+	auto result = duckdb::unique_ptr<JSONPathFilter>(new JSONPathFilter(std::move(path), std::move(child_filter)));
+	return std::move(result);
+}
+
 void StructFilter::Serialize(Serializer &serializer) const {
 	TableFilter::Serialize(serializer);
 	serializer.WritePropertyWithDefault<idx_t>(200, "child_idx", child_idx);
@@ -416,6 +416,29 @@ void SingleFileBlockManager::Read(Block &block) {
 	ReadAndChecksum(block, BLOCK_START + block.id * Storage::BLOCK_ALLOC_SIZE);
 }
 
+void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) {
+	D_ASSERT(start_block >= 0);
+	D_ASSERT(block_count >= 1);
+	D_ASSERT(buffer.AllocSize() >= block_count * Storage::BLOCK_ALLOC_SIZE);
+
+	// read all of the blocks with a single read
+	auto location = BLOCK_START + start_block * Storage::BLOCK_ALLOC_SIZE;
+	auto read_size = block_count * Storage::BLOCK_ALLOC_SIZE;
+	handle->Read(buffer.InternalBuffer(), read_size, location);
+
+	// verify the checksums of all of the blocks
+	for (idx_t i = 0; i < block_count; i++) {
+		auto block_ptr = buffer.InternalBuffer() + i * Storage::BLOCK_ALLOC_SIZE;
+		auto stored_checksum = Load<uint64_t>(block_ptr);
+		uint64_t computed_checksum = Checksum(block_ptr + Storage::BLOCK_HEADER_SIZE, Storage::BLOCK_SIZE);
+		if (stored_checksum != computed_checksum) {
+			throw IOException("Corrupt database file: computed checksum %llu does not match stored checksum %llu in "
+			                  "block at location %llu",
+			                  computed_checksum, stored_checksum, location + i * Storage::BLOCK_ALLOC_SIZE);
+		}
+	}
+}
+
 void SingleFileBlockManager::Write(FileBuffer &buffer, block_id_t block_id) {
 	D_ASSERT(block_id >= 0);
 	ChecksumAndWrite(buffer, BLOCK_START + block_id * Storage::BLOCK_ALLOC_SIZE);
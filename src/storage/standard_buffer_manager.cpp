@@ -55,6 +55,8 @@ StandardBufferManager::StandardBufferManager(DatabaseInstance &db, string tmp)
 	temp_block_manager = make_uniq<InMemoryBlockManager>(*this);
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
 		evicted_data_per_tag[i] = 0;
+		buffer_hits_per_tag[i] = 0;
+		buffer_misses_per_tag[i] = 0;
 	}
 }
 
@@ -174,6 +176,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
+			RegisterAccess(*handle, true);
 			handle->readers++;
 			return handle->Load(handle);
 		}
@@ -189,12 +192,14 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	// check if the block is already loaded
 	if (handle->state == BlockState::BLOCK_LOADED) {
 		// the block is loaded, increment the reader count and return a pointer to the handle
+		RegisterAccess(*handle, true);
 		handle->readers++;
 		reservation.Resize(0);
 		return handle->Load(handle);
 	}
 	// now we can actually load the current block
 	D_ASSERT(handle->readers == 0);
+	RegisterAccess(*handle, false);
 	handle->readers = 1;
 	auto buf = handle->Load(handle, std::move(reusable_buffer));
 	handle->memory_charge = std::move(reservation);
@@ -209,6 +214,118 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	return buf;
 }
 
+void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+                                      block_id_t first_block, block_id_t last_block) {
+	auto &block_manager = handles[0]->block_manager;
+	idx_t block_count = NumericCast<idx_t>(last_block - first_block + 1);
+	if (block_count == 1) {
+		// a single block - pin it, which loads it from disk, and unpin it again so it is added to the eviction queue
+		auto &handle = handles[load_map.find(first_block)->second];
+		Pin(handle);
+		return;
+	}
+	// allocate a (temporary) buffer that can hold all of the blocks and read the blocks into it in a single read
+	auto intermediate_buffer =
+	    Allocate(MemoryTag::BASE_TABLE, block_count * Storage::BLOCK_ALLOC_SIZE - Storage::BLOCK_HEADER_SIZE);
+	block_manager.ReadBlocks(intermediate_buffer.GetFileBuffer(), first_block, block_count);
+
+	// now copy the data over into the individual blocks
+	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
+		block_id_t block_id = first_block + NumericCast<block_id_t>(block_idx);
+		auto entry = load_map.find(block_id);
+		D_ASSERT(entry != load_map.end());
+		auto &handle = handles[entry->second];
+
+		// reserve memory for the block
+		idx_t required_memory = handle->memory_usage;
+		unique_ptr<FileBuffer> reusable_buffer;
+		auto reservation =
+		    EvictBlocksOrThrow(handle->tag, required_memory, &reusable_buffer, "failed to pin block of size %s%s",
+		                       StringUtil::BytesToHumanReadableString(required_memory));
+		// the block handle is returned unpinned: the block is added to the eviction queue and is only kept in memory
+		// as long as nobody needs the space before the scan pins it
+		BufferHandle buf;
+		{
+			lock_guard<mutex> lock(handle->lock);
+			if (handle->state == BlockState::BLOCK_LOADED) {
+				// somebody else loaded the block in the meantime
+				reservation.Resize(0);
+				continue;
+			}
+			D_ASSERT(handle->readers == 0);
+			// the block is read but not used yet: its next pin is its first use
+			buffer_misses_per_tag[uint8_t(handle->tag)]++;
+			auto block_ptr = intermediate_buffer.GetFileBuffer().InternalBuffer() + block_idx * Storage::BLOCK_ALLOC_SIZE;
+			handle->readers = 1;
+			buf = BlockHandle::LoadFromBuffer(handle, block_ptr, std::move(reusable_buffer));
+			handle->memory_charge = std::move(reservation);
+		}
+	}
+}
+
+void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
+	if (handles.empty()) {
+		return;
+	}
+	// read-ahead is speculative: limit the blocks loaded (and the buffer used to read them) to a small fraction of the
+	// memory limit, so that it does not crowd out the rest of the buffer pool
+	static constexpr idx_t MAX_BATCH_READ_BLOCKS = 16;
+	idx_t max_prefetch_blocks = GetMaxMemory() / (8 * Storage::BLOCK_ALLOC_SIZE);
+	if (max_prefetch_blocks < 2) {
+		return;
+	}
+	// figure out which (persistent) blocks still need to be loaded, ordered by block id
+	map<block_id_t, idx_t> to_be_loaded;
+	auto &block_manager = handles[0]->block_manager;
+	for (idx_t i = 0; i < handles.size(); i++) {
+		auto &handle = handles[i];
+		if (handle->BlockId() >= MAXIMUM_BLOCK || &handle->block_manager != &block_manager) {
+			continue;
+		}
+		lock_guard<mutex> lock(handle->lock);
+		if (handle->state == BlockState::BLOCK_UNLOADED) {
+			to_be_loaded.insert(make_pair(handle->BlockId(), i));
+		}
+		if (to_be_loaded.size() >= max_prefetch_blocks) {
+			break;
+		}
+	}
+	if (to_be_loaded.empty()) {
+		return;
+	}
+	// coalesce runs of adjacent blocks into a single read
+	idx_t max_batch_blocks = MinValue<idx_t>(MAX_BATCH_READ_BLOCKS, max_prefetch_blocks / 2);
+	block_id_t first_block = -1;
+	block_id_t previous_block = -1;
+	for (auto &entry : to_be_loaded) {
+		if (previous_block >= 0) {
+			auto run_length = NumericCast<idx_t>(previous_block - first_block + 1);
+			if (entry.first != previous_block + 1 || run_length >= max_batch_blocks) {
+				BatchRead(handles, to_be_loaded, first_block, previous_block);
+				first_block = entry.first;
+			}
+		} else {
+			first_block = entry.first;
+		}
+		previous_block = entry.first;
+	}
+	BatchRead(handles, to_be_loaded, first_block, previous_block);
+}
+
+void StandardBufferManager::RegisterAccess(BlockHandle &handle, bool is_loaded) {
+	auto tag_idx = uint8_t(handle.tag);
+	if (!is_loaded) {
+		buffer_misses_per_tag[tag_idx]++;
+	} else if (handle.access_count > 0) {
+		// the first pin of a freshly allocated (or prefetched) buffer is not a hit
+		buffer_hits_per_tag[tag_idx]++;
+	}
+	if (handle.readers == 0 && handle.access_count < 2) {
+		// a new use of the block (rather than a concurrent pin by another reader)
+		handle.access_count++;
+	}
+}
+
 void StandardBufferManager::PurgeQueue() {
 	buffer_pool.PurgeQueue();
 }
@@ -259,6 +376,8 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage_per_tag[k].load();
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.buffer_hits = buffer_hits_per_tag[k].load();
+		info.buffer_misses = buffer_misses_per_tag[k].load();
 		result.push_back(info);
 	}
 	return result;
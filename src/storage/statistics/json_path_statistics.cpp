@@ -0,0 +1,59 @@
+#include "duckdb/storage/statistics/json_path_statistics.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/string_util.hpp"
+
+namespace duckdb {
+
+JSONPathStatistics::JSONPathStatistics(vector<string> path_p, BaseStatistics stats_p)
+    : path(std::move(path_p)), stats(std::move(stats_p)) {
+}
+
+JSONPathStatistics JSONPathStatistics::Copy() const {
+	return JSONPathStatistics(path, stats.Copy());
+}
+
+string JSONPathStatistics::ToString() const {
+	string result = "$";
+	for (auto &key : path) {
+		result += ".\"" + key + "\"";
+	}
+	return result + ": " + stats.ToString();
+}
+
+void JSONPathStatistics::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty(100, "path", path);
+	serializer.WriteProperty(101, "type", stats.GetType());
+	serializer.WriteProperty(102, "stats", stats);
+}
+
+JSONPathStatistics JSONPathStatistics::Deserialize(Deserializer &deserializer) {
+	auto path = deserializer.ReadProperty<vector<string>>(100, "path");
+	auto type = deserializer.ReadProperty<LogicalType>(101, "type");
+	deserializer.Set<const LogicalType &>(type);
+	auto stats = deserializer.ReadProperty<BaseStatistics>(102, "stats");
+	deserializer.Unset<LogicalType>();
+	return JSONPathStatistics(std::move(path), std::move(stats));
+}
+
+vector<JSONPathStatistics> JSONPathStatistics::Copy(const vector<JSONPathStatistics> &statistics) {
+	vector<JSONPathStatistics> result;
+	result.reserve(statistics.size());
+	for (auto &entry : statistics) {
+		result.push_back(entry.Copy());
+	}
+	return result;
+}
+
+optional_ptr<BaseStatistics> JSONPathStatistics::Find(vector<JSONPathStatistics> &statistics,
+                                                      const vector<string> &path) {
+	for (auto &entry : statistics) {
+		if (entry.path == path) {
+			return &entry.stats;
+		}
+	}
+	return nullptr;
+}
+
+} // namespace duckdb
@@ -253,7 +253,7 @@ bool SingleFileStorageManager::IsCheckpointClean(MetaBlockPointer checkpoint_id)
 	return block_manager->IsRootBlock(checkpoint_id);
 }
 
-void SingleFileStorageManager::CreateCheckpoint(bool delete_wal, bool force_checkpoint) {
+void SingleFileStorageManager::CreateCheckpoint(bool delete_wal, bool force_checkpoint, bool vacuum) {
 	if (InMemory() || read_only || !wal) {
 		return;
 	}
@@ -261,8 +261,21 @@ void SingleFileStorageManager::CreateCheckpoint(bool delete_wal, bool force_chec
 	if (wal->GetWALSize() > 0 || config.options.force_checkpoint || force_checkpoint) {
 		// we only need to checkpoint if there is anything in the WAL
 		try {
-			SingleFileCheckpointWriter checkpointer(db, *block_manager);
+			SingleFileCheckpointWriter checkpointer(db, *block_manager, vacuum);
 			checkpointer.CreateCheckpoint();
+			if (vacuum) {
+				// the blocks vacated by a vacuum checkpoint only become free after it has completed, so data that did
+				// not fit in the free space at the front can be moved there by a subsequent vacuum checkpoint
+				auto total_blocks = block_manager->TotalBlocks();
+				for (idx_t i = 1; i < MAX_VACUUM_CHECKPOINTS && block_manager->FreeBlocks() > 0; i++) {
+					SingleFileCheckpointWriter vacuum_checkpointer(db, *block_manager, vacuum);
+					vacuum_checkpointer.CreateCheckpoint();
+					if (block_manager->TotalBlocks() == total_blocks) {
+						break;
+					}
+					total_blocks = block_manager->TotalBlocks();
+				}
+			}
 		} catch (std::exception &ex) {
 			ErrorData error(ex);
 			throw FatalException("Failed to create checkpoint because of error: %s", error.RawMessage());
@@ -3,6 +3,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/json_path_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
@@ -81,6 +82,27 @@ void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx)
 	state.last_offset = 0;
 }
 
+void ColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state, idx_t rows) {
+	auto current_segment = scan_state.current;
+	if (!current_segment) {
+		return;
+	}
+	idx_t row_index = scan_state.row_index;
+	while (true) {
+		current_segment->InitializePrefetch(prefetch_state);
+		idx_t segment_end = current_segment->start + current_segment->count;
+		if (row_index + rows <= segment_end) {
+			break;
+		}
+		rows -= segment_end - row_index;
+		row_index = segment_end;
+		current_segment = data.GetNextSegment(current_segment);
+		if (!current_segment) {
+			break;
+		}
+	}
+}
+
 idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, bool has_updates) {
 	state.previous_states.clear();
 	if (!state.initialized) {
@@ -246,9 +268,27 @@ bool ColumnData::CheckZonemap(TableFilter &filter) {
 	    propagate_result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
 		return false;
 	}
+	lock_guard<mutex> l(json_path_statistics_lock);
+	if (!json_path_statistics.empty()) {
+		propagate_result = JSONPathFilter::CheckPathStatistics(filter, json_path_statistics);
+		if (propagate_result == FilterPropagateResult::FILTER_ALWAYS_FALSE ||
+		    propagate_result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
+			return false;
+		}
+	}
 	return true;
 }
 
+vector<JSONPathStatistics> ColumnData::GetJSONPathStatistics() {
+	lock_guard<mutex> l(json_path_statistics_lock);
+	return JSONPathStatistics::Copy(json_path_statistics);
+}
+
+void ColumnData::SetJSONPathStatistics(vector<JSONPathStatistics> path_statistics) {
+	lock_guard<mutex> l(json_path_statistics_lock);
+	json_path_statistics = std::move(path_statistics);
+}
+
 unique_ptr<BaseStatistics> ColumnData::GetStatistics() {
 	if (!stats) {
 		throw InternalException("ColumnData::GetStatistics called on a column without stats");
@@ -271,6 +311,8 @@ void ColumnData::MergeIntoStatistics(BaseStatistics &other) {
 }
 
 void ColumnData::InitializeAppend(ColumnAppendState &state) {
+	// the appended values are not reflected in the path statistics
+	SetJSONPathStatistics(vector<JSONPathStatistics>());
 	auto l = data.Lock();
 	if (data.IsEmpty(l)) {
 		// no segments yet, append an empty segment
@@ -363,6 +405,8 @@ void ColumnData::FetchRow(TransactionData transaction, ColumnFetchState &state,
 
 void ColumnData::Update(TransactionData transaction, idx_t column_index, Vector &update_vector, row_t *row_ids,
                         idx_t update_count) {
+	// the updated values are not reflected in the path statistics
+	SetJSONPathStatistics(vector<JSONPathStatistics>());
 	lock_guard<mutex> update_guard(update_lock);
 	if (!updates) {
 		updates = make_uniq<UpdateSegment>(*this);
@@ -456,6 +500,7 @@ unique_ptr<ColumnCheckpointState> ColumnData::Checkpoint(RowGroup &row_group,
 	// replace the old tree with the new one
 	data.Replace(l, checkpoint_state->new_tree);
 	updates.reset();
+	SetJSONPathStatistics(JSONPathStatistics::Copy(checkpoint_state->json_path_statistics));
 
 	return checkpoint_state;
 }
@@ -121,6 +121,9 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 
 	// scan over all the segments and run the analyze step
 	ScanSegments([&](Vector &scan_vector, idx_t count) {
+		if (json_path_analyzer && !json_path_analyzer->Analyze(scan_vector, count)) {
+			json_path_analyzer.reset();
+		}
 		for (idx_t i = 0; i < compression_functions.size(); i++) {
 			if (!compression_functions[i]) {
 				continue;
@@ -138,6 +141,11 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 		}
 	});
 
+	if (json_path_analyzer) {
+		state.json_path_statistics = json_path_analyzer->Finalize();
+		json_path_analyzer.reset();
+	}
+
 	// now that we have passed over all the data, we need to figure out the best method
 	// we do this using the final_analyze method
 	unique_ptr<AnalyzeState> state;
@@ -184,6 +192,12 @@ void ColumnDataCheckpointer::WriteToDisk() {
 		segment->CommitDropSegment();
 	}
 
+	// the statistics of the paths within the JSON objects of a (top-level) JSON column are computed while analyzing
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	if (GetType().IsJSONType() && !col_data.parent && config.json_path_statistics_analyzer) {
+		json_path_analyzer = config.json_path_statistics_analyzer();
+	}
+
 	// now we need to write our segment
 	// we will first run an analyze step that determines which compression function to use
 	idx_t compression_idx;
@@ -225,6 +239,7 @@ bool ColumnDataCheckpointer::HasChanges() {
 void ColumnDataCheckpointer::WritePersistentSegments() {
 	// all segments are persistent and there are no updates
 	// we only need to write the metadata
+	state.json_path_statistics = col_data.GetJSONPathStatistics();
 	for (idx_t segment_idx = 0; segment_idx < nodes.size(); segment_idx++) {
 		auto segment = nodes[segment_idx].node.get();
 		D_ASSERT(segment->segment_type == ColumnSegmentType::PERSISTENT);
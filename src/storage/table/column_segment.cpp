@@ -103,6 +103,13 @@ void ColumnSegment::InitializeScan(ColumnScanState &state) {
 	state.scan_state = function.get().init_scan(*this);
 }
 
+void ColumnSegment::InitializePrefetch(PrefetchState &prefetch_state) {
+	if (segment_type != ColumnSegmentType::PERSISTENT || !block) {
+		return;
+	}
+	prefetch_state.AddBlock(block);
+}
+
 void ColumnSegment::Scan(ColumnScanState &state, idx_t scan_count, Vector &result, idx_t result_offset,
                          bool entire_vector) {
 	if (entire_vector) {
@@ -364,27 +371,26 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_OR: {
 		// similar to the CONJUNCTION_AND, but we need to take care of the SelectionVectors (OR all of them)
-		idx_t count_total = 0;
-		SelectionVector result_sel(approved_tuple_count);
+		// we mark the tuples that pass any of the children, and then select them in their original order
+		D_ASSERT(scan_count <= STANDARD_VECTOR_SIZE);
+		bool passed[STANDARD_VECTOR_SIZE];
+		memset(passed, 0, scan_count * sizeof(bool));
 		auto &conjunction_or = filter.Cast<ConjunctionOrFilter>();
 		for (auto &child_filter : conjunction_or.child_filters) {
 			SelectionVector temp_sel;
 			temp_sel.Initialize(sel);
 			idx_t temp_tuple_count = approved_tuple_count;
 			idx_t temp_count = FilterSelection(temp_sel, vector, vdata, *child_filter, scan_count, temp_tuple_count);
-			// tuples passed, move them into the actual result vector
 			for (idx_t i = 0; i < temp_count; i++) {
-				auto new_idx = temp_sel.get_index(i);
-				bool is_new_idx = true;
-				for (idx_t res_idx = 0; res_idx < count_total; res_idx++) {
-					if (result_sel.get_index(res_idx) == new_idx) {
-						is_new_idx = false;
-						break;
-					}
-				}
-				if (is_new_idx) {
-					result_sel.set_index(count_total++, new_idx);
-				}
+				passed[temp_sel.get_index(i)] = true;
+			}
+		}
+		idx_t count_total = 0;
+		SelectionVector result_sel(approved_tuple_count);
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			if (passed[idx]) {
+				result_sel.set_index(count_total++, idx);
 			}
 		}
 		sel.Initialize(result_sel);
@@ -500,6 +506,9 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return FilterSelection(sel, *child_vec, child_data, *struct_filter.child_filter, scan_count,
 		                       approved_tuple_count);
 	}
+	case TableFilterType::JSON_PATH:
+		// the JSON path filter is only used to skip row groups, the filter on the extracted value remains in the plan
+		return approved_tuple_count;
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
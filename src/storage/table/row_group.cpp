@@ -200,6 +200,7 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	PrefetchScan(state, vector_offset * STANDARD_VECTOR_SIZE);
 	return true;
 }
 
@@ -229,9 +230,28 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	PrefetchScan(state, 0);
 	return true;
 }
 
+void RowGroup::PrefetchScan(CollectionScanState &state, idx_t row_offset) {
+	if (row_offset + STANDARD_VECTOR_SIZE >= state.max_row_group_row) {
+		// we are scanning (at most) a single vector - the blocks are loaded when the scan pins them
+		return;
+	}
+	auto &column_ids = state.GetColumnIds();
+	idx_t rows = state.max_row_group_row - row_offset;
+	PrefetchState prefetch_state;
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		const auto &column = column_ids[i];
+		if (column != COLUMN_IDENTIFIER_ROW_ID) {
+			GetColumn(column).InitializePrefetch(prefetch_state, state.column_scans[i], rows);
+		}
+	}
+	auto &buffer_manager = GetBlockManager().buffer_manager;
+	buffer_manager.Prefetch(prefetch_state.blocks);
+}
+
 unique_ptr<RowGroup> RowGroup::AlterType(RowGroupCollection &new_collection, const LogicalType &target_type,
                                          idx_t changed_idx, ExpressionExecutor &executor,
                                          CollectionScanState &scan_state, DataChunk &scan_chunk) {
@@ -396,6 +416,7 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::JSON_PATH:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -685,8 +706,9 @@ void RowGroup::FetchRow(TransactionData transaction, ColumnFetchState &state, co
 void RowGroup::AppendVersionInfo(TransactionData transaction, idx_t count) {
 	idx_t row_group_start = this->count.load();
 	idx_t row_group_end = row_group_start + count;
-	if (row_group_end > Storage::ROW_GROUP_SIZE) {
-		row_group_end = Storage::ROW_GROUP_SIZE;
+	idx_t row_group_size = GetCollection().GetRowGroupSize();
+	if (row_group_end > row_group_size) {
+		row_group_end = row_group_size;
 	}
 	// create the version_info if it doesn't exist yet
 	auto &vinfo = GetOrCreateVersionInfo();
@@ -14,6 +14,12 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/sort/sorted_block.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
 
 namespace duckdb {
 
@@ -66,6 +72,15 @@ const vector<LogicalType> &RowGroupCollection::GetTypes() const {
 	return types;
 }
 
+idx_t RowGroupCollection::GetRowGroupSize() const {
+	return info->row_group_size;
+}
+
+idx_t RowGroupCollection::GetParallelScanVectorCount() const {
+	// large row groups are split into multiple scan tasks so they don't limit the scan parallelism
+	return MinValue<idx_t>(GetRowGroupSize(), Storage::ROW_GROUP_SIZE) / STANDARD_VECTOR_SIZE;
+}
+
 Allocator &RowGroupCollection::GetAllocator() const {
 	return Allocator::Get(info->db);
 }
@@ -186,13 +201,18 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 			}
 			collection = state.collection;
 			row_group = state.current_row_group;
-			if (ClientConfig::GetConfig(context).verify_parallelism) {
+			idx_t scan_vector_count = ClientConfig::GetConfig(context).verify_parallelism
+			                              ? 1
+			                              : collection->GetParallelScanVectorCount();
+			if (state.vector_index > 0 || state.current_row_group->count > scan_vector_count * STANDARD_VECTOR_SIZE) {
+				// scan a range of vectors of the row group
 				vector_index = state.vector_index;
 				max_row = state.current_row_group->start +
 				          MinValue<idx_t>(state.current_row_group->count,
-				                          STANDARD_VECTOR_SIZE * state.vector_index + STANDARD_VECTOR_SIZE);
+				                          STANDARD_VECTOR_SIZE * (state.vector_index + scan_vector_count));
 				D_ASSERT(vector_index * STANDARD_VECTOR_SIZE < state.current_row_group->count);
-				state.vector_index++;
+				state.processed_rows += max_row - state.current_row_group->start - vector_index * STANDARD_VECTOR_SIZE;
+				state.vector_index += scan_vector_count;
 				if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
 					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
 					state.vector_index = 0;
@@ -332,6 +352,7 @@ bool RowGroupCollection::Append(DataChunk &chunk, TableAppendState &state) {
 	chunk.Verify();
 
 	bool new_row_group = false;
+	idx_t row_group_size = GetRowGroupSize();
 	idx_t total_append_count = chunk.size();
 	idx_t remaining = chunk.size();
 	state.total_append_count += total_append_count;
@@ -339,7 +360,7 @@ bool RowGroupCollection::Append(DataChunk &chunk, TableAppendState &state) {
 		auto current_row_group = state.row_group_append_state.row_group;
 		// check how much we can fit into the current row_group
 		idx_t append_count =
-		    MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE - state.row_group_append_state.offset_in_row_group);
+		    MinValue<idx_t>(remaining, row_group_size - state.row_group_append_state.offset_in_row_group);
 		if (append_count > 0) {
 			auto previous_allocation_size = current_row_group->GetAllocationSize();
 			current_row_group->Append(state.row_group_append_state, chunk, append_count);
@@ -385,7 +406,7 @@ void RowGroupCollection::FinalizeAppend(TransactionData transaction, TableAppend
 	auto remaining = state.total_append_count;
 	auto row_group = state.start_row_group;
 	while (remaining > 0) {
-		auto append_count = MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE - row_group->count);
+		auto append_count = MinValue<idx_t>(remaining, GetRowGroupSize() - row_group->count);
 		row_group->AppendVersionInfo(transaction, append_count);
 		remaining -= append_count;
 		row_group = row_groups->GetNextSegment(row_group);
@@ -727,6 +748,8 @@ struct VacuumState {
 	idx_t row_start = 0;
 	idx_t next_vacuum_idx = 0;
 	vector<idx_t> row_group_counts;
+	//! Whether or not a row group has to be rewritten, even if it cannot be merged with its neighbours
+	vector<bool> rewrite_row_group;
 };
 
 class VacuumTask : public BaseCheckpointTask {
@@ -740,13 +763,14 @@ public:
 	void ExecuteTask() override {
 		auto &collection = checkpoint_state.collection;
 		auto &types = collection.GetTypes();
+		auto row_group_size = collection.GetRowGroupSize();
 		// create the new set of target row groups (initially empty)
 		vector<unique_ptr<RowGroup>> new_row_groups;
 		vector<idx_t> append_counts;
 		idx_t row_group_rows = merge_rows;
 		idx_t start = row_start;
 		for (idx_t target_idx = 0; target_idx < target_count; target_idx++) {
-			idx_t current_row_group_rows = MinValue<idx_t>(row_group_rows, Storage::ROW_GROUP_SIZE);
+			idx_t current_row_group_rows = MinValue<idx_t>(row_group_rows, row_group_size);
 			auto new_row_group = make_uniq<RowGroup>(collection, start, current_row_group_rows);
 			new_row_group->InitializeEmpty(types);
 			new_row_groups.push_back(std::move(new_row_group));
@@ -796,12 +820,12 @@ public:
 				idx_t remaining = scan_chunk.size();
 				while (remaining > 0) {
 					idx_t append_count =
-					    MinValue<idx_t>(remaining, Storage::ROW_GROUP_SIZE - append_counts[current_append_idx]);
+					    MinValue<idx_t>(remaining, row_group_size - append_counts[current_append_idx]);
 					new_row_groups[current_append_idx]->Append(append_state.row_group_append_state, scan_chunk,
 					                                           append_count);
 					append_counts[current_append_idx] += append_count;
 					remaining -= append_count;
-					const bool row_group_full = append_counts[current_append_idx] == Storage::ROW_GROUP_SIZE;
+					const bool row_group_full = append_counts[current_append_idx] == row_group_size;
 					const bool last_row_group = current_append_idx + 1 >= new_row_groups.size();
 					if (remaining > 0 || (row_group_full && !last_row_group)) {
 						// move to the next row group
@@ -843,22 +867,48 @@ private:
 	idx_t row_start;
 };
 
-void RowGroupCollection::InitializeVacuumState(VacuumState &state, vector<SegmentNode<RowGroup>> &segments) {
+//! Whether or not any of the persistent data of the row group is stored at or after the given block
+static bool RowGroupUsesBlocksFrom(RowGroup &row_group, block_id_t block_id) {
+	vector<ColumnSegmentInfo> segment_info;
+	row_group.GetColumnSegmentInfo(row_group.index, segment_info);
+	for (auto &segment : segment_info) {
+		if (segment.persistent && segment.block_id >= block_id) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void RowGroupCollection::InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
+                                               vector<SegmentNode<RowGroup>> &segments) {
 	state.can_vacuum_deletes = info->indexes.Empty();
 	if (!state.can_vacuum_deletes) {
 		return;
 	}
+	auto delete_threshold = checkpoint_state.writer.GetVacuumDeleteThreshold();
+	auto compaction_block = checkpoint_state.writer.GetCompactionBlock();
 	// obtain the set of committed row counts for each row group
 	state.row_group_counts.reserve(segments.size());
+	state.rewrite_row_group.reserve(segments.size());
 	for (auto &entry : segments) {
 		auto &row_group = *entry.node;
 		auto row_group_count = row_group.GetCommittedRowCount();
+		bool rewrite = false;
 		if (row_group_count == 0) {
 			// empty row group - we can drop it entirely
 			row_group.CommitDrop();
 			entry.node.reset();
+		} else {
+			// rewrite row groups with too many deleted rows
+			auto deleted_rows = row_group.count - row_group_count;
+			rewrite = deleted_rows > 0 && double(deleted_rows) > delete_threshold * double(row_group.count);
+			// rewrite row groups that keep the tail of the database file alive
+			if (!rewrite && compaction_block != INVALID_BLOCK) {
+				rewrite = RowGroupUsesBlocksFrom(row_group, compaction_block);
+			}
 		}
 		state.row_group_counts.push_back(row_group_count);
+		state.rewrite_row_group.push_back(rewrite);
 	}
 }
 
@@ -891,7 +941,7 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 	// we greedily prefer to merge to the lowest target_count
 	// i.e. we prefer to merge 2 row groups into 1, than 3 row groups into 2
 	for (target_count = 1; target_count <= MAX_MERGE_COUNT; target_count++) {
-		auto total_target_size = target_count * Storage::ROW_GROUP_SIZE;
+		auto total_target_size = target_count * GetRowGroupSize();
 		merge_count = 0;
 		merge_rows = 0;
 		for (next_idx = segment_idx; next_idx < checkpoint_state.segments.size(); next_idx++) {
@@ -914,7 +964,14 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 		}
 	}
 	if (!perform_merge) {
-		return false;
+		if (!state.rewrite_row_group[segment_idx]) {
+			return false;
+		}
+		// the row group cannot be merged with its neighbours but has to be rewritten by itself
+		merge_count = 1;
+		target_count = 1;
+		merge_rows = state.row_group_counts[segment_idx];
+		next_idx = segment_idx + 1;
 	}
 	// schedule the vacuum task
 	auto vacuum_task = make_uniq<VacuumTask>(checkpoint_state, state, segment_idx, merge_count, target_count,
@@ -926,6 +983,195 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 	return true;
 }
 
+//===--------------------------------------------------------------------===//
+// Cluster
+//===--------------------------------------------------------------------===//
+//! Obtain the [min, max] zone of a column in a row group, returns false if the zone is unknown
+static bool GetClusterZone(RowGroup &row_group, idx_t column_idx, Value &min, Value &max) {
+	auto stats = row_group.GetStatistics(column_idx);
+	switch (stats->GetStatsType()) {
+	case StatisticsType::NUMERIC_STATS:
+		if (!NumericStats::HasMinMax(*stats)) {
+			return false;
+		}
+		min = NumericStats::Min(*stats);
+		max = NumericStats::Max(*stats);
+		return true;
+	case StatisticsType::STRING_STATS:
+		min = Value::BLOB_RAW(StringStats::Min(*stats));
+		max = Value::BLOB_RAW(StringStats::Max(*stats));
+		return min <= max;
+	default:
+		return false;
+	}
+}
+
+idx_t RowGroupCollection::FindUnclusteredRowGroup(vector<SegmentNode<RowGroup>> &segments, VacuumState &state,
+                                                  idx_t column_idx) {
+	vector<idx_t> indexes;
+	vector<Value> mins;
+	vector<Value> maxes;
+	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
+		if (state.row_group_counts[segment_idx] == 0) {
+			continue;
+		}
+		Value min, max;
+		if (!GetClusterZone(*segments[segment_idx].node, column_idx, min, max)) {
+			// no zone information - cluster everything
+			return segments.empty() ? DConstants::INVALID_INDEX : 0;
+		}
+		indexes.push_back(segment_idx);
+		mins.push_back(std::move(min));
+		maxes.push_back(std::move(max));
+	}
+	// find the first row group whose zone overlaps with the zone of the row group before it
+	idx_t first_overlap = DConstants::INVALID_INDEX;
+	for (idx_t i = 1; i < indexes.size(); i++) {
+		if (maxes[i - 1] > mins[i]) {
+			first_overlap = i;
+			break;
+		}
+	}
+	if (first_overlap == DConstants::INVALID_INDEX) {
+		// the row groups are already clustered
+		return DConstants::INVALID_INDEX;
+	}
+	// every row group that has values larger than the smallest value in the tail has to be re-clustered as well
+	Value tail_min = mins[first_overlap];
+	for (idx_t i = first_overlap + 1; i < indexes.size(); i++) {
+		if (mins[i] < tail_min) {
+			tail_min = mins[i];
+		}
+	}
+	for (idx_t i = 0; i < first_overlap; i++) {
+		if (maxes[i] > tail_min) {
+			return indexes[i];
+		}
+	}
+	return indexes[first_overlap];
+}
+
+void RowGroupCollection::ClusterRowGroups(vector<SegmentNode<RowGroup>> &segments, VacuumState &state,
+                                          const vector<PhysicalIndex> &cluster_columns) {
+	D_ASSERT(!cluster_columns.empty());
+	auto cluster_start = FindUnclusteredRowGroup(segments, state, cluster_columns[0].index);
+	if (cluster_start == DConstants::INVALID_INDEX) {
+		return;
+	}
+	// sort the committed rows of all row groups in [cluster_start, end) on the cluster key
+	vector<BoundOrderByNode> orders;
+	vector<LogicalType> key_types;
+	for (idx_t key_idx = 0; key_idx < cluster_columns.size(); key_idx++) {
+		auto &key_type = types[cluster_columns[key_idx].index];
+		key_types.push_back(key_type);
+		orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST,
+		                    make_uniq<BoundReferenceExpression>(key_type, key_idx));
+	}
+	RowLayout payload_layout;
+	payload_layout.Initialize(types);
+	auto &buffer_manager = BufferManager::GetBufferManager(GetAttached().GetDatabase());
+	GlobalSortState global_sort(buffer_manager, orders, payload_layout);
+	LocalSortState local_sort;
+	local_sort.Initialize(global_sort, buffer_manager);
+
+	DataChunk scan_chunk;
+	scan_chunk.Initialize(Allocator::DefaultAllocator(), types);
+	DataChunk key_chunk;
+	key_chunk.InitializeEmpty(key_types);
+
+	vector<column_t> column_ids;
+	for (idx_t c = 0; c < types.size(); c++) {
+		column_ids.push_back(c);
+	}
+	TableScanState scan_state;
+	scan_state.Initialize(column_ids);
+	scan_state.table_state.Initialize(types);
+	scan_state.table_state.max_row = idx_t(-1);
+	idx_t cluster_rows = 0;
+	for (idx_t segment_idx = cluster_start; segment_idx < segments.size(); segment_idx++) {
+		if (state.row_group_counts[segment_idx] == 0) {
+			continue;
+		}
+		auto &row_group = *segments[segment_idx].node;
+		row_group.InitializeScan(scan_state.table_state);
+		while (true) {
+			scan_chunk.Reset();
+			row_group.ScanCommitted(scan_state.table_state, scan_chunk,
+			                        TableScanType::TABLE_SCAN_COMMITTED_ROWS_OMIT_PERMANENTLY_DELETED);
+			if (scan_chunk.size() == 0) {
+				break;
+			}
+			for (idx_t key_idx = 0; key_idx < cluster_columns.size(); key_idx++) {
+				key_chunk.data[key_idx].Reference(scan_chunk.data[cluster_columns[key_idx].index]);
+			}
+			key_chunk.SetCardinality(scan_chunk);
+			local_sort.SinkChunk(key_chunk, scan_chunk);
+			cluster_rows += scan_chunk.size();
+		}
+	}
+	if (cluster_rows == 0) {
+		return;
+	}
+	global_sort.AddLocalState(local_sort);
+	global_sort.PrepareMergePhase();
+	while (global_sort.sorted_blocks.size() > 1) {
+		global_sort.InitializeMergeRound();
+		MergeSorter merge_sorter(global_sort, buffer_manager);
+		merge_sorter.PerformInMergeRound();
+		global_sort.CompleteMergeRound();
+	}
+
+	// write the sorted rows into a fresh set of row groups
+	auto row_group_size = GetRowGroupSize();
+	vector<unique_ptr<RowGroup>> new_row_groups;
+	TableAppendState append_state;
+	PayloadScanner scanner(global_sort);
+	idx_t remaining_rows = cluster_rows;
+	while (scanner.Remaining() > 0) {
+		scan_chunk.Reset();
+		scanner.Scan(scan_chunk);
+		idx_t remaining = scan_chunk.size();
+		while (remaining > 0) {
+			if (new_row_groups.empty() || new_row_groups.back()->count == row_group_size) {
+				auto new_row_group = make_uniq<RowGroup>(*this, 0, 0);
+				new_row_group->InitializeEmpty(types);
+				new_row_group->InitializeAppend(append_state.row_group_append_state);
+				new_row_groups.push_back(std::move(new_row_group));
+			}
+			auto &row_group = *new_row_groups.back();
+			idx_t append_count = MinValue<idx_t>(remaining, row_group_size - row_group.count);
+			row_group.Append(append_state.row_group_append_state, scan_chunk, append_count);
+			row_group.count += append_count;
+			remaining -= append_count;
+			remaining_rows -= append_count;
+			if (remaining > 0) {
+				// slice chunk for the next append
+				scan_chunk.Slice(append_count, remaining);
+			}
+		}
+	}
+	if (remaining_rows != 0) {
+		throw InternalException("Mismatch in row count while clustering row groups in RowGroupCollection::Checkpoint");
+	}
+	// replace the old row groups with the clustered row groups
+	for (idx_t segment_idx = cluster_start; segment_idx < segments.size(); segment_idx++) {
+		auto &entry = segments[segment_idx];
+		if (entry.node) {
+			entry.node->CommitDrop();
+			entry.node.reset();
+		}
+		state.row_group_counts[segment_idx] = 0;
+		state.rewrite_row_group[segment_idx] = false;
+	}
+	D_ASSERT(cluster_start + new_row_groups.size() <= segments.size());
+	for (idx_t i = 0; i < new_row_groups.size(); i++) {
+		auto &row_group = new_row_groups[i];
+		row_group->Verify();
+		state.row_group_counts[cluster_start + i] = row_group->count;
+		segments[cluster_start + i].node = std::move(row_group);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint
 //===--------------------------------------------------------------------===//
@@ -941,7 +1187,12 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 	CollectionCheckpointState checkpoint_state(*this, writer, segments, global_stats);
 
 	VacuumState vacuum_state;
-	InitializeVacuumState(vacuum_state, segments);
+	InitializeVacuumState(checkpoint_state, vacuum_state, segments);
+	auto cluster_columns = writer.GetClusterColumns();
+	if (vacuum_state.can_vacuum_deletes && !cluster_columns.empty()) {
+		// re-cluster the row groups that were appended or modified since the last checkpoint
+		ClusterRowGroups(segments, vacuum_state, cluster_columns);
+	}
 	// schedule tasks
 	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
 		auto &entry = segments[segment_idx];
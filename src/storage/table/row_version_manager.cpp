@@ -14,7 +14,7 @@ void RowVersionManager::SetStart(idx_t new_start) {
 	lock_guard<mutex> l(version_lock);
 	this->start = new_start;
 	idx_t current_start = start;
-	for (idx_t i = 0; i < Storage::ROW_GROUP_VECTOR_COUNT; i++) {
+	for (idx_t i = 0; i < vector_info.size(); i++) {
 		if (vector_info[i]) {
 			vector_info[i]->start = current_start;
 		}
@@ -25,7 +25,7 @@ void RowVersionManager::SetStart(idx_t new_start) {
 idx_t RowVersionManager::GetCommittedDeletedCount(idx_t count) {
 	lock_guard<mutex> l(version_lock);
 	idx_t deleted_count = 0;
-	for (idx_t r = 0, i = 0; r < count; r += STANDARD_VECTOR_SIZE, i++) {
+	for (idx_t r = 0, i = 0; r < count && i < vector_info.size(); r += STANDARD_VECTOR_SIZE, i++) {
 		if (!vector_info[i]) {
 			continue;
 		}
@@ -39,9 +39,18 @@ idx_t RowVersionManager::GetCommittedDeletedCount(idx_t count) {
 }
 
 optional_ptr<ChunkInfo> RowVersionManager::GetChunkInfo(idx_t vector_idx) {
+	if (vector_idx >= vector_info.size()) {
+		return nullptr;
+	}
 	return vector_info[vector_idx].get();
 }
 
+void RowVersionManager::FillVectorInfo(idx_t vector_idx) {
+	if (vector_idx >= vector_info.size()) {
+		vector_info.resize(vector_idx + 1);
+	}
+}
+
 idx_t RowVersionManager::GetSelVector(TransactionData transaction, idx_t vector_idx, SelectionVector &sel_vector,
                                       idx_t max_count) {
 	lock_guard<mutex> l(version_lock);
@@ -78,6 +87,7 @@ void RowVersionManager::AppendVersionInfo(TransactionData transaction, idx_t cou
 	has_changes = true;
 	idx_t start_vector_idx = row_group_start / STANDARD_VECTOR_SIZE;
 	idx_t end_vector_idx = (row_group_end - 1) / STANDARD_VECTOR_SIZE;
+	FillVectorInfo(end_vector_idx);
 	for (idx_t vector_idx = start_vector_idx; vector_idx <= end_vector_idx; vector_idx++) {
 		idx_t vector_start =
 		    vector_idx == start_vector_idx ? row_group_start - start_vector_idx * STANDARD_VECTOR_SIZE : 0;
@@ -130,12 +140,13 @@ void RowVersionManager::CommitAppend(transaction_t commit_id, idx_t row_group_st
 void RowVersionManager::RevertAppend(idx_t start_row) {
 	lock_guard<mutex> lock(version_lock);
 	idx_t start_vector_idx = (start_row + (STANDARD_VECTOR_SIZE - 1)) / STANDARD_VECTOR_SIZE;
-	for (idx_t vector_idx = start_vector_idx; vector_idx < Storage::ROW_GROUP_VECTOR_COUNT; vector_idx++) {
+	for (idx_t vector_idx = start_vector_idx; vector_idx < vector_info.size(); vector_idx++) {
 		vector_info[vector_idx].reset();
 	}
 }
 
 ChunkVectorInfo &RowVersionManager::GetVectorInfo(idx_t vector_idx) {
+	FillVectorInfo(vector_idx);
 	if (!vector_info[vector_idx]) {
 		// no info yet: create it
 		vector_info[vector_idx] = make_uniq<ChunkVectorInfo>(start + vector_idx * STANDARD_VECTOR_SIZE);
@@ -176,7 +187,7 @@ vector<MetaBlockPointer> RowVersionManager::Checkpoint(MetadataManager &manager)
 	}
 	// first count how many ChunkInfo's we need to deserialize
 	vector<pair<idx_t, reference<ChunkInfo>>> to_serialize;
-	for (idx_t vector_idx = 0; vector_idx < Storage::ROW_GROUP_VECTOR_COUNT; vector_idx++) {
+	for (idx_t vector_idx = 0; vector_idx < vector_info.size(); vector_idx++) {
 		auto chunk_info = vector_info[vector_idx].get();
 		if (!chunk_info) {
 			continue;
@@ -218,10 +229,11 @@ shared_ptr<RowVersionManager> RowVersionManager::Deserialize(MetaBlockPointer de
 	D_ASSERT(chunk_count > 0);
 	for (idx_t i = 0; i < chunk_count; i++) {
 		idx_t vector_index = source.Read<idx_t>();
-		if (vector_index >= Storage::ROW_GROUP_VECTOR_COUNT) {
+		if (vector_index >= Storage::MAX_ROW_GROUP_SIZE / STANDARD_VECTOR_SIZE) {
 			throw InternalException(
 			    "In DeserializeDeletes, vector_index is out of range for the row group. Corrupted file?");
 		}
+		version_info->FillVectorInfo(vector_index);
 		version_info->vector_info[vector_index] = ChunkInfo::Read(source);
 	}
 	version_info->has_changes = false;
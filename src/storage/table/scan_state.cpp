@@ -55,6 +55,14 @@ void ColumnScanState::Next(idx_t count) {
 	}
 }
 
+void PrefetchState::AddBlock(shared_ptr<BlockHandle> block) {
+	// segments that share a block are adjacent - skip the block if we have just added it
+	if (!blocks.empty() && blocks.back().get() == block.get()) {
+		return;
+	}
+	blocks.push_back(std::move(block));
+}
+
 const vector<storage_t> &CollectionScanState::GetColumnIds() {
 	return parent.GetColumnIds();
 }
@@ -59,6 +59,11 @@ void StandardColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t
 	validity.InitializeScanWithOffset(state.child_states[0], row_idx);
 }
 
+void StandardColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state, idx_t rows) {
+	ColumnData::InitializePrefetch(prefetch_state, scan_state, rows);
+	validity.InitializePrefetch(prefetch_state, scan_state.child_states[0], rows);
+}
+
 idx_t StandardColumnData::Scan(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
                                Vector &result) {
 	D_ASSERT(state.row_index == state.child_states[0].row_index);
@@ -179,6 +184,7 @@ public:
 		ColumnCheckpointState::WriteDataPointers(writer, serializer);
 		serializer.WriteObject(101, "validity",
 		                       [&](Serializer &serializer) { validity_state->WriteDataPointers(writer, serializer); });
+		serializer.WritePropertyWithDefault(102, "json_path_statistics", json_path_statistics);
 	}
 };
 
@@ -214,6 +220,8 @@ void StandardColumnData::DeserializeColumn(Deserializer &deserializer, BaseStati
 	ColumnData::DeserializeColumn(deserializer, target_stats);
 	deserializer.ReadObject(
 	    101, "validity", [&](Deserializer &deserializer) { validity.DeserializeColumn(deserializer, target_stats); });
+	auto path_statistics = deserializer.ReadPropertyWithDefault<vector<JSONPathStatistics>>(102, "json_path_statistics");
+	SetJSONPathStatistics(std::move(path_statistics));
 }
 
 void StandardColumnData::GetColumnSegmentInfo(duckdb::idx_t row_group_index, vector<duckdb::idx_t> col_path,
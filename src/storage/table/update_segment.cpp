@@ -3,6 +3,7 @@
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
 
 #include "duckdb/storage/table/column_data.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/transaction/update_info.hpp"
 #include "duckdb/common/printer.hpp"
@@ -21,6 +22,12 @@ static UpdateSegment::rollback_update_function_t GetRollbackUpdateFunction(Physi
 static UpdateSegment::statistics_update_function_t GetStatisticsUpdateFunction(PhysicalType type);
 static UpdateSegment::fetch_row_function_t GetFetchRowFunction(PhysicalType type);
 
+UpdateNode::UpdateNode(idx_t vector_count) : info(vector_count) {
+}
+
+UpdateNode::~UpdateNode() {
+}
+
 UpdateSegment::UpdateSegment(ColumnData &column_data)
     : column_data(column_data), stats(column_data.type), heap(BufferAllocator::Get(column_data.GetDatabase())) {
 	auto physical_type = column_data.type.InternalType();
@@ -334,7 +341,7 @@ void UpdateSegment::FetchCommittedRange(idx_t start_row, idx_t count, Vector &re
 	idx_t start_vector = start_row / STANDARD_VECTOR_SIZE;
 	idx_t end_vector = (end_row - 1) / STANDARD_VECTOR_SIZE;
 	D_ASSERT(start_vector <= end_vector);
-	D_ASSERT(end_vector < Storage::ROW_GROUP_VECTOR_COUNT);
+	D_ASSERT(end_vector < root->info.size());
 
 	for (idx_t vector_idx = start_vector; vector_idx <= end_vector; vector_idx++) {
 		if (!root->info[vector_idx]) {
@@ -1097,7 +1104,8 @@ void UpdateSegment::Update(TransactionData transaction, idx_t column_index, Vect
 
 	// create the versions for this segment, if there are none yet
 	if (!root) {
-		root = make_uniq<UpdateNode>();
+		auto vector_count = column_data.GetTableInfo().row_group_size / STANDARD_VECTOR_SIZE;
+		root = make_uniq<UpdateNode>(vector_count);
 	}
 
 	// get the vector index based on the first id
@@ -1107,7 +1115,7 @@ void UpdateSegment::Update(TransactionData transaction, idx_t column_index, Vect
 	idx_t vector_offset = column_data.start + vector_index * STANDARD_VECTOR_SIZE;
 
 	D_ASSERT(idx_t(first_id) >= column_data.start);
-	D_ASSERT(vector_index < Storage::ROW_GROUP_VECTOR_COUNT);
+	D_ASSERT(vector_index < root->info.size());
 
 	// first check the version chain
 	UpdateInfo *node = nullptr;
@@ -1228,7 +1236,7 @@ bool UpdateSegment::HasUpdates(idx_t start_row_index, idx_t end_row_index) {
 	auto read_lock = lock.GetSharedLock();
 	idx_t base_vector_index = start_row_index / STANDARD_VECTOR_SIZE;
 	idx_t end_vector_index = end_row_index / STANDARD_VECTOR_SIZE;
-	for (idx_t i = base_vector_index; i <= end_vector_index; i++) {
+	for (idx_t i = base_vector_index; i <= end_vector_index && i < root->info.size(); i++) {
 		if (root->info[i]) {
 			return true;
 		}
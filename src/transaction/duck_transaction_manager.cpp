@@ -92,6 +92,14 @@ Transaction &DuckTransactionManager::StartTransaction(ClientContext &context) {
 }
 
 void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
+	CheckpointInternal(context, force, false);
+}
+
+void DuckTransactionManager::Vacuum(ClientContext &context) {
+	CheckpointInternal(context, false, true);
+}
+
+void DuckTransactionManager::CheckpointInternal(ClientContext &context, bool force, bool vacuum) {
 	auto &storage_manager = db.GetStorageManager();
 	if (storage_manager.InMemory()) {
 		return;
@@ -145,7 +153,7 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 			D_ASSERT(CanCheckpoint(nullptr).can_checkpoint);
 		}
 	}
-	storage_manager.CreateCheckpoint();
+	storage_manager.CreateCheckpoint(false, vacuum, vacuum);
 }
 
 DuckTransactionManager::CheckpointDecision
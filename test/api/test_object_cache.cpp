@@ -34,6 +34,22 @@ struct AnotherTestObject : public ObjectCacheEntry {
 	}
 };
 
+struct SizedTestObject : public ObjectCacheEntry {
+	idx_t size;
+	SizedTestObject(idx_t size) : size(size) {
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+	optional_idx GetEstimatedCacheMemory() const override {
+		return size;
+	}
+
+	static string ObjectType() {
+		return "SizedTestObject";
+	}
+};
+
 TEST_CASE("Test ObjectCache", "[api]") {
 	DuckDB db;
 	Connection con(db);
@@ -56,3 +72,43 @@ TEST_CASE("Test ObjectCache", "[api]") {
 
 	REQUIRE(cache.GetOrCreate<AnotherTestObject>("test", 13) == nullptr);
 }
+
+TEST_CASE("Test ObjectCache memory limit", "[api]") {
+	DuckDB db;
+	Connection con(db);
+	auto &context = *con.context;
+
+	auto &cache = ObjectCache::GetObjectCache(context);
+	cache.SetMaxMemory(100);
+
+	cache.Put("unsized", make_shared<TestObject>(42));
+	cache.Put("a", make_shared<SizedTestObject>(40));
+	cache.Put("b", make_shared<SizedTestObject>(40));
+	REQUIRE(cache.GetMemoryUsage() == 80);
+
+	// "a" is the least recently used entry after this
+	REQUIRE(cache.Get<SizedTestObject>("b") != nullptr);
+	cache.Put("c", make_shared<SizedTestObject>(40));
+	REQUIRE(cache.GetMemoryUsage() == 80);
+	REQUIRE(cache.GetObject("a") == nullptr);
+	REQUIRE(cache.GetObject("b") != nullptr);
+	REQUIRE(cache.GetObject("c") != nullptr);
+
+	// replacing an entry updates the memory usage
+	cache.Put("c", make_shared<SizedTestObject>(10));
+	REQUIRE(cache.GetMemoryUsage() == 50);
+	REQUIRE(cache.Get<SizedTestObject>("c")->size == 10);
+
+	// lowering the limit evicts entries, but never the ones without an estimated size
+	cache.SetMaxMemory(20);
+	REQUIRE(cache.GetMemoryUsage() == 10);
+	REQUIRE(cache.GetObject("b") == nullptr);
+	REQUIRE(cache.GetObject("c") != nullptr);
+	cache.SetMaxMemory(0);
+	REQUIRE(cache.GetMemoryUsage() == 0);
+	REQUIRE(cache.GetObject("c") == nullptr);
+	REQUIRE(cache.Get<TestObject>("unsized")->value == 42);
+
+	cache.Delete("unsized");
+	REQUIRE(cache.GetObject("unsized") == nullptr);
+}
@@ -3884,6 +3884,16 @@ void ColumnMetaData::__set_encoding_stats(const duckdb::vector<PageEncodingStats
   this->encoding_stats = val;
 __isset.encoding_stats = true;
 }
+
+void ColumnMetaData::__set_bloom_filter_offset(const int64_t val) {
+  this->bloom_filter_offset = val;
+__isset.bloom_filter_offset = true;
+}
+
+void ColumnMetaData::__set_bloom_filter_length(const int32_t val) {
+  this->bloom_filter_length = val;
+__isset.bloom_filter_length = true;
+}
 std::ostream& operator<<(std::ostream& out, const ColumnMetaData& obj)
 {
   obj.printTo(out);
@@ -4078,6 +4088,22 @@ uint32_t ColumnMetaData::read(::duckdb_apache::thrift::protocol::TProtocol* ipro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 14:
+        if (ftype == ::duckdb_apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->bloom_filter_offset);
+          this->__isset.bloom_filter_offset = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 15:
+        if (ftype == ::duckdb_apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->bloom_filter_length);
+          this->__isset.bloom_filter_length = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -4200,6 +4226,16 @@ uint32_t ColumnMetaData::write(::duckdb_apache::thrift::protocol::TProtocol* opr
     }
     xfer += oprot->writeFieldEnd();
   }
+  if (this->__isset.bloom_filter_offset) {
+    xfer += oprot->writeFieldBegin("bloom_filter_offset", ::duckdb_apache::thrift::protocol::T_I64, 14);
+    xfer += oprot->writeI64(this->bloom_filter_offset);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.bloom_filter_length) {
+    xfer += oprot->writeFieldBegin("bloom_filter_length", ::duckdb_apache::thrift::protocol::T_I32, 15);
+    xfer += oprot->writeI32(this->bloom_filter_length);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -4220,6 +4256,8 @@ void swap(ColumnMetaData &a, ColumnMetaData &b) {
   swap(a.dictionary_page_offset, b.dictionary_page_offset);
   swap(a.statistics, b.statistics);
   swap(a.encoding_stats, b.encoding_stats);
+  swap(a.bloom_filter_offset, b.bloom_filter_offset);
+  swap(a.bloom_filter_length, b.bloom_filter_length);
   swap(a.__isset, b.__isset);
 }
 
@@ -4237,6 +4275,8 @@ ColumnMetaData::ColumnMetaData(const ColumnMetaData& other94) {
   dictionary_page_offset = other94.dictionary_page_offset;
   statistics = other94.statistics;
   encoding_stats = other94.encoding_stats;
+  bloom_filter_offset = other94.bloom_filter_offset;
+  bloom_filter_length = other94.bloom_filter_length;
   __isset = other94.__isset;
 }
 ColumnMetaData& ColumnMetaData::operator=(const ColumnMetaData& other95) {
@@ -4253,6 +4293,8 @@ ColumnMetaData& ColumnMetaData::operator=(const ColumnMetaData& other95) {
   dictionary_page_offset = other95.dictionary_page_offset;
   statistics = other95.statistics;
   encoding_stats = other95.encoding_stats;
+  bloom_filter_offset = other95.bloom_filter_offset;
+  bloom_filter_length = other95.bloom_filter_length;
   __isset = other95.__isset;
   return *this;
 }
@@ -4272,6 +4314,8 @@ void ColumnMetaData::printTo(std::ostream& out) const {
   out << ", " << "dictionary_page_offset="; (__isset.dictionary_page_offset ? (out << to_string(dictionary_page_offset)) : (out << "<null>"));
   out << ", " << "statistics="; (__isset.statistics ? (out << to_string(statistics)) : (out << "<null>"));
   out << ", " << "encoding_stats="; (__isset.encoding_stats ? (out << to_string(encoding_stats)) : (out << "<null>"));
+  out << ", " << "bloom_filter_offset="; (__isset.bloom_filter_offset ? (out << to_string(bloom_filter_offset)) : (out << "<null>"));
+  out << ", " << "bloom_filter_length="; (__isset.bloom_filter_length ? (out << to_string(bloom_filter_length)) : (out << "<null>"));
   out << ")";
 }
 